@@ -1154,6 +1154,10 @@ macro(process_options)
   if(${NS3_ASSERT} OR (${build_profile} STREQUAL "debug"))
     add_definitions(-DNS3_ASSERT_ENABLE)
   endif()
+  # Thread-safe reference counts and packets, for MultithreadedSimulatorImpl
+  if(${NS3_MTP})
+    add_definitions(-DNS3_MTP)
+  endif()
 
   set(ENABLE_TAP OFF)
   if(${NS3_TAP})
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/helper/athstats-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/log-linear-histogram.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lorawan-0.3.5/helper/lora-coverage-estimator.h"
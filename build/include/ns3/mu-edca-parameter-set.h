@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/he/mu-edca-parameter-set.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/point-to-point/helper/point-to-point-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/test/spectrum-test.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/table-based-error-rate-model.h"
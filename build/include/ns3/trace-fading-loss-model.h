@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/trace-fading-loss-model.h"
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Tell whether the seeds already run for one sweep point agree.
+
+Looks at every results/<experiment>/run_<seed>_<timestamp>/ whose metadata.json
+matches all the --match KEY=VALUE pairs (the newest run of each seed is used),
+and exits with status 0 when at least --min-runs seeds are available and the
+95% confidence interval half-width of their mean packet delivery ratio is below
+--half-width, 1 otherwise.
+
+Runs branched from the same warmed-up run (same "branchOf" in metadata.json)
+share their warm-up, so they are not independent: their PDRs are averaged
+into a single replication.
+"""
+
+import argparse
+import glob
+import json
+import math
+import os
+import sys
+
+# Two-sided 95% Student-t quantiles, by degrees of freedom
+T_95 = {
+    1: 12.706, 2: 4.303, 3: 3.182, 4: 2.776, 5: 2.571, 6: 2.447, 7: 2.365,
+    8: 2.306, 9: 2.262, 10: 2.228, 15: 2.131, 20: 2.086, 30: 2.042,
+}
+
+
+def t_95(df):
+    for k in sorted(T_95):
+        if df <= k:
+            return T_95[k]
+    return 1.96
+
+
+def matches(meta, key, value):
+    if key not in meta:
+        return False
+    try:
+        return math.isclose(float(meta[key]), float(value))
+    except (TypeError, ValueError):
+        return str(meta[key]) == value
+
+
+def load_pdrs(folder, constraints):
+    newest = {}
+    for run in glob.glob(os.path.join(folder, "run_*")):
+        meta_path = os.path.join(run, "metadata.json")
+        metrics_path = os.path.join(run, "metrics.json")
+        if not (os.path.exists(meta_path) and os.path.exists(metrics_path)):
+            continue
+        meta = json.load(open(meta_path))
+        if not all(matches(meta, k, v) for k, v in constraints):
+            continue
+        seed = meta.get("seed")
+        base = meta.get("branchOf", seed)
+        timestamp = int(os.path.basename(run).rsplit("_", 1)[-1])
+        key = (base, seed)
+        if key not in newest or newest[key][0] < timestamp:
+            newest[key] = (timestamp, metrics_path)
+
+    replications = {}
+    for (base, _), (_, metrics_path) in newest.items():
+        metrics = json.load(open(metrics_path))
+        replications.setdefault(base, []).append(float(metrics["packetDeliveryRatio"]))
+    return [sum(p) / len(p) for p in replications.values()]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("folder", help="results/<experimentName> folder")
+    parser.add_argument("--half-width", type=float, default=0.02,
+                        help="target 95%% CI half-width of the mean PDR")
+    parser.add_argument("--min-runs", type=int, default=3,
+                        help="minimum number of seeds before testing")
+    parser.add_argument("--match", action="append", default=[],
+                        metavar="KEY=VALUE", help="metadata.json constraint")
+    args = parser.parse_args()
+
+    constraints = [m.split("=", 1) for m in args.match]
+    pdrs = load_pdrs(args.folder, constraints)
+    n = len(pdrs)
+    if n < max(2, args.min_runs):
+        print(f"{n} seed(s): not enough to test convergence")
+        return 1
+
+    mean = sum(pdrs) / n
+    var = sum((p - mean) ** 2 for p in pdrs) / (n - 1)
+    half_width = t_95(n - 1) * math.sqrt(var / n)
+    converged = half_width <= args.half_width
+    print(f"{n} seeds: PDR {mean:.4f} +- {half_width:.4f}"
+          f" ({'converged' if converged else 'not converged'})")
+    return 0 if converged else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -77,6 +77,8 @@ def parse_metrics_json(filename="metrics.json", duration=None):
         data = json.load(f)
 
     bytes_per_packet = data.get("bytesPerPacket", 0)
+    # Runs may end before simTimeSec once they have converged
+    duration = data.get("simulatedTimeSec", duration)
 
     node_tx = {int(k): int(v) for k, v in data["nodePacketsSent"].items()}
     node_rx = {int(k): int(v) for k, v in data["nodePacketsReceived"].items()}
@@ -124,6 +126,27 @@ def load_energy_csv(path):
         remaining[int(node)] = rem
     return remaining
 
+
+def load_energy_series(path):
+    # energy.bin written by ns3::energy::EnergyRecorder:
+    # "NS3ENRG1" followed by blocks of (uint32 node, uint32 n, double t[n], double e[n])
+    series = {}
+    with open(path, "rb") as f:
+        if f.read(8) != b"NS3ENRG1":
+            raise ValueError(f"{path} is not an energy recorder file")
+        while True:
+            header = np.fromfile(f, dtype=np.uint32, count=2)
+            if header.size < 2:
+                break
+            node, n = int(header[0]), int(header[1])
+            t = np.fromfile(f, dtype=np.float64, count=n)
+            e = np.fromfile(f, dtype=np.float64, count=n)
+            times, energies = series.setdefault(node, ([], []))
+            times.append(t)
+            energies.append(e)
+    # node -> (time_s, remaining_energy_j)
+    return {node: (np.concatenate(t), np.concatenate(e)) for node, (t, e) in series.items()}
+
 # ============================================================
 # Compute single-run metrics
 # ============================================================
@@ -19,6 +19,20 @@ DISTANCES=(10 30 50 75 100 150 200 300 500 1000 5000 7500 10000)
 # Number of repeated runs per (env, distance)
 NUM_RUNS=5
 
+# Seeds are launched in waves of MIN_RUNS; no more waves are launched once the
+# mean PDR of the seeds run so far has a 95% CI half-width below PDR_HALF_WIDTH
+MIN_RUNS=3
+PDR_HALF_WIDTH=0.02
+
+# Each run also stops early once its own PDR has converged (batches of BATCH s)
+BATCH=15
+
+# With PRUNE=1, every point is first estimated analytically and only the
+# points whose estimated PDR is within [PDR_LOW, PDR_HIGH] are simulated
+PRUNE=0
+PDR_LOW=0.02
+PDR_HIGH=0.98
+
 # Additional common ns-3 parameters
 SIM_TIME=150
 INTERVAL=30
@@ -35,46 +49,81 @@ echo "Starting SDcloud experiment batch..."
 echo "Experiment Name: ${EXPERIMENT_NAME}"
 echo "------------------------------------------------"
 
+ESTIMATE="results/${EXPERIMENT_NAME}/estimate.csv"
+if (( PRUNE )); then
+    eval "${NS3} \"scratch/sdcloud-lora-estimate/estimate \
+        --experimentName=${EXPERIMENT_NAME} \
+        --environments=$(IFS=,; echo "${ENVIRONMENTS[*]}") \
+        --distances=$(IFS=,; echo "${DISTANCES[*]}") \
+        --nDevices=${DEVICES} \
+        --intervalSec=${INTERVAL} \
+        --payloadBytes=${PAYLOAD} \
+        --pdrLow=${PDR_LOW} \
+        --pdrHigh=${PDR_HIGH}\""
+    echo "------------------------------------------------"
+fi
+
 for ENV in "${ENVIRONMENTS[@]}"; do
     for DIST in "${DISTANCES[@]}"; do
-        bg_pids=()
-        for RUN in $(seq 1 "${NUM_RUNS}"); do
-
-            # wifi command
-            # CMD="${NS3} \"${SIM_NAME} \
-            #     --topology=star \
-            #     --technology=wifi \
-            #     --experimentName=${EXPERIMENT_NAME} \
-            #     --intervalSec=${INTERVAL} \
-            #     --payloadBytes=${PAYLOAD} \
-            #     --simTimeSec=${SIM_TIME} \
-            #     --nDevices=${DEVICES} \
-            #     --txPowerDbm=${TXPOWER} \
-            #     --environment=${ENV} \
-            #     --distance=${DIST} \
-            #     --runSeed=${RUN}\""
-
-            # lora command
-            CMD="${NS3} \"${SIM_NAME} \
-                --experimentName=${EXPERIMENT_NAME} \
-                --intervalSec=${INTERVAL} \
-                --payloadBytes=${PAYLOAD} \
-                --simTimeSec=${SIM_TIME} \
-                --nDevices=${DEVICES} \
-                --environment=${ENV} \
-                --distance=${DIST} \
-                --runSeed=${RUN}\""
-
-            echo "Starting ENV=${ENV}, DIST=${DIST}, RUN=${RUN}"
-            eval "${CMD}" &
-            bg_pids+=($!)
-        done
+        if (( PRUNE )) && ! grep -q "^${ENV},${DIST},${DEVICES},.*,1$" "${ESTIMATE}"; then
+            echo "Skipping ENV=${ENV}, DIST=${DIST}: estimated PDR is not uncertain"
+            echo "------------------------------------------------"
+            continue
+        fi
+
+        RUN=0
+        while (( RUN < NUM_RUNS )); do
+            bg_pids=()
+            WAVE_END=$(( RUN + MIN_RUNS < NUM_RUNS ? RUN + MIN_RUNS : NUM_RUNS ))
+            while (( RUN < WAVE_END )); do
+                RUN=$(( RUN + 1 ))
+
+                # wifi command
+                # CMD="${NS3} \"${SIM_NAME} \
+                #     --topology=star \
+                #     --technology=wifi \
+                #     --experimentName=${EXPERIMENT_NAME} \
+                #     --intervalSec=${INTERVAL} \
+                #     --payloadBytes=${PAYLOAD} \
+                #     --simTimeSec=${SIM_TIME} \
+                #     --nDevices=${DEVICES} \
+                #     --txPowerDbm=${TXPOWER} \
+                #     --environment=${ENV} \
+                #     --distance=${DIST} \
+                #     --runSeed=${RUN}\""
+
+                # lora command
+                CMD="${NS3} \"${SIM_NAME} \
+                    --experimentName=${EXPERIMENT_NAME} \
+                    --intervalSec=${INTERVAL} \
+                    --payloadBytes=${PAYLOAD} \
+                    --simTimeSec=${SIM_TIME} \
+                    --nDevices=${DEVICES} \
+                    --environment=${ENV} \
+                    --distance=${DIST} \
+                    --stopOnConvergence=1 \
+                    --batchSec=${BATCH} \
+                    --runSeed=${RUN}\""
+
+                echo "Starting ENV=${ENV}, DIST=${DIST}, RUN=${RUN}"
+                eval "${CMD}" &
+                bg_pids+=($!)
+            done
+
+            # Wait for this wave of RUNs for (ENV, DIST)
+            for pid in "${bg_pids[@]}"; do
+                wait "${pid}"
+            done
 
-        # Wait for all RUNs for this (ENV, DIST)
-        for pid in "${bg_pids[@]}"; do
-            wait "${pid}"
+            if python3 check_convergence.py "results/${EXPERIMENT_NAME}" \
+                --half-width "${PDR_HALF_WIDTH}" --min-runs "${MIN_RUNS}" \
+                --match "environment=${ENV}" --match "distance=${DIST}" \
+                --match "nDevices=${DEVICES}" --match "intervalSec=${INTERVAL}" \
+                --match "payloadBytes=${PAYLOAD}" --match "simTimeSec=${SIM_TIME}"; then
+                break
+            fi
         done
-        echo "Completed all RUNs for ENV=${ENV}, DIST=${DIST}"
+        echo "Completed ${RUN} RUNs for ENV=${ENV}, DIST=${DIST}"
         echo "------------------------------------------------"
     done
 done
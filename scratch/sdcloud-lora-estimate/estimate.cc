@@ -0,0 +1,113 @@
+/*
+ * Analytical coverage and PDR estimate of the sdcloud-lora sweep grid.
+ *
+ * Builds, for every (environment, distance, nDevices) point, the same
+ * deployment and propagation loss chain as scratch/sdcloud-lora/lora.cc
+ * (see lora-scenario.h) and
+ * estimates it with LoraCoverageEstimator instead of simulating it.
+ *
+ * Output: results/<experimentName>/estimate.csv with one line per point:
+ *   environment,distance,nDevices,coverage,pdr,simulate
+ * where coverage is the fraction of covered devices, pdr the mean estimated
+ * PDR and simulate whether the mean PDR lies within [pdrLow, pdrHigh], i.e.
+ * whether the point is worth a full simulation.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+
+#include "ns3/lora-coverage-estimator.h"
+
+#include "../sdcloud-lora/lora-scenario.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+using namespace lorawan;
+
+NS_LOG_COMPONENT_DEFINE("SdcloudLoraEstimate");
+
+int main(int argc, char* argv[])
+{
+    std::string environments = "field,forest";
+    std::string distances    = "10,30,50,75,100,150,200,300,500,1000,5000,7500,10000";
+    std::string devices      = "64";
+    double   intervalSec     = 30.0;
+    uint32_t payloadBytes    = 32;
+    std::string experimentName = "lora_default";
+    double   pdrLow          = 0.02;    // below: the point is surely lost
+    double   pdrHigh         = 0.98;    // above: the point surely delivers
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("environments", "Comma-separated environments (field | forest)", environments);
+    cmd.AddValue("distances", "Comma-separated grid sizes (m)", distances);
+    cmd.AddValue("nDevices", "Comma-separated numbers of end devices", devices);
+    cmd.AddValue("intervalSec", "LoRa application interval (s)", intervalSec);
+    cmd.AddValue("payloadBytes", "LoRa payload size (bytes)", payloadBytes);
+    cmd.AddValue("experimentName", "Experiment folder name", experimentName);
+    cmd.AddValue("pdrLow", "Estimated PDR below which a point is not simulated", pdrLow);
+    cmd.AddValue("pdrHigh", "Estimated PDR above which a point is not simulated", pdrHigh);
+    cmd.Parse(argc, argv);
+
+    // The sender helper keeps the payload size on 8 bits
+    NS_ABORT_MSG_IF(payloadBytes > 255, "LoRa payloads are limited to 255 bytes");
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    std::string outDir = "results/" + experimentName + "/";
+    system(("mkdir -p " + outDir).c_str());
+    std::ofstream out((outDir + "estimate.csv").c_str());
+    out << "environment,distance,nDevices,coverage,pdr,simulate\n";
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t nLinks = 0;
+    for (const auto& environment : SplitString(environments, ","))
+    {
+        for (const auto& distanceStr : SplitString(distances, ","))
+        {
+            for (const auto& nDevicesStr : SplitString(devices, ","))
+            {
+                double distance = std::stod(distanceStr);
+                uint32_t nDevices = std::stoul(nDevicesStr);
+
+                LoraCoverageEstimator estimator;
+                estimator.SetPropagationLossModel(CreateLossModel(environment));
+                estimator.SetPacketSize(static_cast<uint8_t>(payloadBytes));
+                estimator.SetPeriod(Seconds(intervalSec));
+                estimator.AddGateway(Vector(distance / 2, distance / 2, 2.0));
+
+                auto estimates = estimator.Estimate(CreateDevicePositions(nDevices, distance));
+                nLinks += estimates.size();
+
+                double covered = 0;
+                double pdr = 0;
+                for (const auto& estimate : estimates)
+                {
+                    covered += estimate.covered;
+                    pdr += estimate.pdr;
+                }
+                covered /= nDevices;
+                pdr /= nDevices;
+                bool simulate = pdr >= pdrLow && pdr <= pdrHigh;
+
+                out << environment << "," << distance << "," << nDevices << "," << covered << ","
+                    << pdr << "," << (simulate ? 1 : 0) << "\n";
+                std::cout << environment << " " << distance << " m, " << nDevices
+                          << " devices: coverage " << covered << ", PDR " << pdr
+                          << (simulate ? " (simulate)" : "") << std::endl;
+            }
+        }
+    }
+
+    double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Estimated " << nLinks << " devices in " << elapsed << " s.\n";
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Deployment and propagation loss chain of the sdcloud-lora scenario, shared
+ * by the simulation (lora.cc) and its analytical estimate
+ * (../sdcloud-lora-estimate/estimate.cc) so that both always describe the
+ * same network.
+ */
+
+#ifndef SDCLOUD_LORA_SCENARIO_H
+#define SDCLOUD_LORA_SCENARIO_H
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/propagation-loss-model.h"
+
+#include "ns3/correlated-shadowing-propagation-loss-model.h"
+#include "ns3/forest-penetration-loss.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace lorawan
+{
+
+/**
+ * Log-distance path loss, with correlated shadowing and forest penetration
+ * loss in the forest.
+ *
+ * @param environment field | forest
+ * @return the first model of the chain
+ */
+inline Ptr<PropagationLossModel>
+CreateLossModel(const std::string& environment)
+{
+    Ptr<LogDistancePropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel>();
+    loss->SetPathLossExponent(2.0);
+    loss->SetReference(1, 31.0);
+
+    if (environment == "forest")
+    {
+        loss->SetPathLossExponent(3.5);
+        Ptr<CorrelatedShadowingPropagationLossModel> shadowing =
+            CreateObject<CorrelatedShadowingPropagationLossModel>();
+        loss->SetNext(shadowing);
+
+        Ptr<ForestPenetrationLoss> forestLoss = CreateObject<ForestPenetrationLoss>();
+        shadowing->SetNext(forestLoss);
+    }
+    return loss;
+}
+
+/**
+ * Square grid of end devices spanning distance x distance, row first, with
+ * the devices lifted to 1.5 m.
+ *
+ * @param nDevices the number of devices (a perfect square)
+ * @param distance the side of the grid (m)
+ * @return the device positions
+ */
+inline std::vector<Vector>
+CreateDevicePositions(uint32_t nDevices, double distance)
+{
+    uint32_t k = static_cast<uint32_t>(std::sqrt(nDevices));
+    double delta = (k > 1) ? distance / (k - 1) : 0.0;
+
+    Ptr<GridPositionAllocator> grid = CreateObject<GridPositionAllocator>();
+    grid->SetMinX(0.0);
+    grid->SetMinY(0.0);
+    grid->SetDeltaX(delta);
+    grid->SetDeltaY(delta);
+    grid->SetN(k);
+    grid->SetLayoutType(GridPositionAllocator::ROW_FIRST);
+
+    std::vector<Vector> positions;
+    for (uint32_t i = 0; i < nDevices; ++i)
+    {
+        Vector pos = grid->GetNext();
+        pos.z = 1.5;
+        positions.push_back(pos);
+    }
+    return positions;
+}
+
+} // namespace lorawan
+} // namespace ns3
+
+#endif /* SDCLOUD_LORA_SCENARIO_H */
@@ -3,8 +3,17 @@
  *
  * Outputs (under results/<experimentName>/run_<runSeed>_<timestamp>/):
  *  - metadata.json : simulation parameters
- *  - metrics.json  : packets sent/received, loss, and energy usage
- *  - energy.csv    : per-node remaining energy over time
+ *  - metrics.json  : packets sent/received, loss, energy usage and latency
+ *                    mean and p50/p95/p99 (per node and network-wide)
+ *  - energy.csv    : per-node remaining energy at the end of the run
+ *  - energy.bin    : per-node remaining energy over time (EnergyRecorder format)
+ *
+ * With --warmUpSec and --branches, the scenario is built and warmed up once
+ * under runSeed, then branched into runSeed, runSeed + 1, ... which each
+ * finish the run in their own process and write their own output folder
+ * (run_<seed>_b<branch>_<timestamp>). --branchIntervalsSec additionally
+ * branches every seed into each of the listed send intervals, which apply
+ * from the next transmission of every device after the warm-up.
  */
 
 #include "ns3/core-module.h"
@@ -12,15 +21,17 @@
 #include "ns3/mobility-module.h"
 #include "ns3/point-to-point-module.h"
 #include "ns3/energy-module.h"
+#include "ns3/log-linear-histogram.h"
+#include "ns3/simulator-checkpoint.h"
 
 #include "ns3/basic-energy-source.h"
 #include "ns3/basic-energy-source-helper.h"
+#include "ns3/energy-recorder-helper.h"
 #include "ns3/lora-radio-energy-model.h"
 #include "ns3/lora-radio-energy-model-helper.h"
 
 #include "ns3/constant-position-mobility-model.h"
-#include "ns3/correlated-shadowing-propagation-loss-model.h"
-#include "ns3/forest-penetration-loss.h"
+#include "ns3/convergence-monitor.h"
 
 #include "ns3/end-device-lora-phy.h"
 #include "ns3/end-device-lorawan-mac.h"
@@ -34,6 +45,7 @@
 #include "ns3/lora-phy.h"
 #include "ns3/lorawan-mac-header.h"
 #include "ns3/network-server-helper.h"
+#include "ns3/periodic-sender.h"
 #include "ns3/periodic-sender-helper.h"
 #include "ns3/position-allocator.h"
 #include "ns3/random-variable-stream.h"
@@ -42,13 +54,16 @@
 #include "ns3/simulator.h"
 
 #include "ns3/sender-id-tag.h"
-#include "ns3/forest-penetration-loss.h"
+
+#include "lora-scenario.h"
 
 #include <ctime>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 using namespace lorawan;
@@ -63,7 +78,7 @@ static uint64_t g_packetsReceived = 0;
 static std::ofstream g_energyCsv;
 static std::unordered_map<uint32_t, uint64_t> nodePacketsSent;
 static std::unordered_map<uint32_t, uint64_t> nodePacketsReceived;
-static std::unordered_map<uint32_t, std::vector<double>> nodeLatencies;
+static std::unordered_map<uint32_t, LogLinearHistogram> nodeLatencies;
 
 // ---------------- Traces ----------------
 
@@ -84,24 +99,17 @@ static void OnPacketReceptionCallback(Ptr<const Packet> packet, uint32_t receive
         // std::cout << Simulator::Now().GetSeconds() << " " << tag.GetSendTime() << std::endl;
         uint32_t senderNode = tag.GetSenderId();
         ++nodePacketsReceived[senderNode];
-        nodeLatencies[senderNode].push_back(Simulator::Now().GetSeconds() - tag.GetSendTime());
+        nodeLatencies[senderNode].Update(Simulator::Now().GetSeconds() - tag.GetSendTime());
     }
 }
 
-static void RemainingEnergyTrace(uint32_t nodeId, double oldValue, double newValue)
-{
-    // g_energyCsv << Simulator::Now().GetSeconds() << ","
-    //             << nodeId << ","
-    //             << newValue << std::endl;
-}
-
 // ---------------- Energy model setup ----------------
 
-DeviceEnergyModelContainer SetupLoraEnergyModel(NodeContainer& nodes, NetDeviceContainer& devices, const std::string& filename)
+DeviceEnergyModelContainer SetupLoraEnergyModel(NodeContainer& nodes,
+                                                NetDeviceContainer& devices,
+                                                Ptr<EnergyRecorder>& recorder,
+                                                double seriesResolutionSec)
 {
-    g_energyCsv.open(filename.c_str());
-    g_energyCsv << "time,node,remaining_energy_joules\n";
-
     BasicEnergySourceHelper sourceHelper;
     sourceHelper.Set("BasicEnergySourceInitialEnergyJ", DoubleValue(300.0));
     EnergySourceContainer sources = sourceHelper.Install(nodes);
@@ -115,14 +123,12 @@ DeviceEnergyModelContainer SetupLoraEnergyModel(NodeContainer& nodes, NetDeviceC
 
     DeviceEnergyModelContainer models = loraEnergy.Install(devices, sources);
 
-    // Trace remaining energy over time
-    for (uint32_t i = 0; i < sources.GetN(); ++i)
-    {
-        Ptr<EnergySource> src = sources.Get(i);
-        src->TraceConnectWithoutContext(
-            "RemainingEnergy",
-            MakeBoundCallback(&RemainingEnergyTrace, i));
-    }
+    // Trace remaining energy over time, decimated and written in bulk; the
+    // samples stay in memory until the output folder, hence the file name, is known
+    EnergyRecorderHelper recorderHelper;
+    recorderHelper.SetRecorderAttribute("FileName", StringValue(""));
+    recorderHelper.SetRecorderAttribute("Resolution", TimeValue(Seconds(seriesResolutionSec)));
+    recorder = recorderHelper.Install(sources);
 
     return models;
 }
@@ -140,6 +146,14 @@ int main(int argc, char* argv[])
     std::string     environment = "field";  // correlated shadowing + buildings
     std::string experimentName = "lora_default";
     uint32_t runSeed         = 1;
+    double   energyResolutionSec = 1.0; // energy time-series resolution (s)
+    bool     stopOnConvergence = false;  // end the run once PDR has converged
+    double   pdrHalfWidth    = 0.01;    // target PDR confidence half-width
+    double   batchSec        = 30.0;    // convergence batch duration (s)
+    double   warmUpSec       = 0.0;     // simulated time shared by all branches (s)
+    uint32_t branches        = 1;       // seeds branched from the warmed-up state
+    uint32_t branchParallel  = 1;       // branches running at the same time
+    std::string branchIntervalsSec;     // send intervals branched after the warm-up (s)
 
     CommandLine cmd(__FILE__);
     cmd.AddValue("nDevices", "Number of end devices", nDevices);
@@ -152,23 +166,43 @@ int main(int argc, char* argv[])
                  environment);
     cmd.AddValue("experimentName", "Experiment folder name", experimentName);
     cmd.AddValue("runSeed", "Run number / RNG seed", runSeed);
+    cmd.AddValue("energyResolutionSec",
+                 "Minimum time between two samples of the energy time series (s)",
+                 energyResolutionSec);
+    cmd.AddValue("stopOnConvergence",
+                 "Stop the run once PDR and energy per bit have converged",
+                 stopOnConvergence);
+    cmd.AddValue("pdrHalfWidth", "Target 95% confidence half-width of the PDR", pdrHalfWidth);
+    cmd.AddValue("batchSec", "Duration of a convergence batch (s)", batchSec);
+    cmd.AddValue("warmUpSec",
+                 "Simulated time run once, before branching into the seeds (s)",
+                 warmUpSec);
+    cmd.AddValue("branches",
+                 "Number of seeds (runSeed, runSeed + 1, ...) branched after the warm-up",
+                 branches);
+    cmd.AddValue("branchParallel", "Maximum number of branches running at once", branchParallel);
+    cmd.AddValue("branchIntervalsSec",
+                 "Comma-separated send intervals each seed is branched into after the warm-up (s)",
+                 branchIntervalsSec);
     cmd.Parse(argc, argv);
 
+    std::vector<double> branchIntervals;
+    {
+        std::istringstream list(branchIntervalsSec);
+        std::string item;
+        while (std::getline(list, item, ','))
+        {
+            branchIntervals.push_back(std::stod(item));
+        }
+    }
+    if (branchIntervals.empty())
+    {
+        branchIntervals.push_back(intervalSec);
+    }
+
     RngSeedManager::SetSeed(1);
     RngSeedManager::SetRun(runSeed);
 
-    // Output directory
-    std::string timestamp = std::to_string(time(nullptr));
-    std::string outDir =
-        "results/" + experimentName +
-        "/run_" + std::to_string(runSeed) + "_" + timestamp + "/";
-
-    system(("mkdir -p " + outDir).c_str());
-
-    std::string energyFile  = outDir + "energy.csv";
-    std::string metaFile    = outDir + "metadata.json";
-    std::string metricsFile = outDir + "metrics.json";
-
     for (uint32_t i = 0; i < nDevices; ++i)
     {
         nodePacketsSent[i] = 0;
@@ -180,18 +214,6 @@ int main(int argc, char* argv[])
      ***********/
 
     MobilityHelper mobility;
-    uint32_t k = static_cast<uint32_t>(std::sqrt(nDevices));
-    double delta = (k > 1) ? distance / (k - 1) : 0.0;
-
-    mobility.SetPositionAllocator(
-        "ns3::GridPositionAllocator",
-        "MinX", DoubleValue(0.0),
-        "MinY", DoubleValue(0.0),
-        "DeltaX", DoubleValue(delta),
-        "DeltaY", DoubleValue(delta),
-        "GridWidth", UintegerValue(k),
-        "LayoutType", StringValue("RowFirst")
-    );
     mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
 
     /************************
@@ -200,18 +222,14 @@ int main(int argc, char* argv[])
 
     NodeContainer endDevices;
     endDevices.Create(nDevices);
-    mobility.Install(endDevices);
 
-    // Lift devices to some height > 0
-    for (auto j = endDevices.Begin(); j != endDevices.End(); ++j)
+    Ptr<ListPositionAllocator> devicePositions = CreateObject<ListPositionAllocator>();
+    for (const auto& pos : CreateDevicePositions(nDevices, distance))
     {
-        Ptr<MobilityModel> mob = (*j)->GetObject<MobilityModel>();
-        Vector pos = mob->GetPosition();
-        pos.z = 1.5;
-        mob->SetPosition(pos);
-        // auto raisedPos = mob->GetPosition();
-        // std::cout << "Sensor at " << raisedPos.x << "," << raisedPos.y << "," << raisedPos.z << "\n";
+        devicePositions->Add(pos);
     }
+    mobility.SetPositionAllocator(devicePositions);
+    mobility.Install(endDevices);
 
     /*********************
      *  Create gateways  *
@@ -234,20 +252,7 @@ int main(int argc, char* argv[])
      *  Create the channel  *
      ************************/
 
-    Ptr<LogDistancePropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel>();
-    loss->SetPathLossExponent(2.0);
-    loss->SetReference(1, 31.0);
-
-    if (environment == "forest")
-    {
-        loss->SetPathLossExponent(3.5);
-        Ptr<CorrelatedShadowingPropagationLossModel> shadowing =
-            CreateObject<CorrelatedShadowingPropagationLossModel>();
-        loss->SetNext(shadowing);
-
-        Ptr<ForestPenetrationLoss> forestLoss = CreateObject<ForestPenetrationLoss>();
-        shadowing->SetNext(forestLoss);
-    }
+    Ptr<PropagationLossModel> loss = CreateLossModel(environment);
 
     Ptr<PropagationDelayModel> delay = CreateObject<ConstantSpeedPropagationDelayModel>();
     Ptr<LoraChannel> channel = CreateObject<LoraChannel>(loss, delay);
@@ -296,7 +301,11 @@ int main(int argc, char* argv[])
      *  Energy model for end devices    *
      ************************************/
 
-    DeviceEnergyModelContainer energyModels = SetupLoraEnergyModel(endDevices, endDeviceDevs, energyFile);
+    Ptr<EnergyRecorder> energyRecorder;
+    DeviceEnergyModelContainer energyModels = SetupLoraEnergyModel(endDevices,
+                                                                   endDeviceDevs,
+                                                                   energyRecorder,
+                                                                   energyResolutionSec);
 
     /*********************************************
      *  Install applications on the end devices  *
@@ -305,6 +314,7 @@ int main(int argc, char* argv[])
     PeriodicSenderHelper appHelper;
     appHelper.SetPeriod(Seconds(intervalSec));
     appHelper.SetPacketSize(payloadBytes);
+    ApplicationContainer senderApps;
 
     // Ptr<UniformRandomVariable> jitter = CreateObject<UniformRandomVariable>();
     // jitter->SetAttribute("Min", DoubleValue(0.0));
@@ -313,6 +323,7 @@ int main(int argc, char* argv[])
     for (uint32_t i = 0; i < nDevices; ++i)
     {
         ApplicationContainer app = appHelper.Install(endDevices.Get(i));
+        senderApps.Add(app);
         double start = 2 + i * 0.25;
         app.Start(Seconds(start));
         app.Stop(Seconds(simTimeSec - 2.0));
@@ -382,16 +393,92 @@ int main(int argc, char* argv[])
         std::cout << "SF: " << sf << std::endl;
     }
 
+    /****************************
+     *  Sequential stopping rule *
+     ****************************/
+
+    Ptr<ConvergenceMonitor> convergence = CreateObject<ConvergenceMonitor>();
+    convergence->SetAttribute("BatchInterval", TimeValue(Seconds(batchSec)));
+    convergence->SetAttribute("PdrHalfWidth", DoubleValue(pdrHalfWidth));
+    convergence->SetAttribute("StopSimulation", BooleanValue(stopOnConvergence));
+    convergence->SetEnergyModels(energyModels);
+    convergence->Install(endDevices, gateways);
+
+    /*************************
+     *  Warm-up and branching *
+     *************************/
+
+    NS_ABORT_MSG_IF(warmUpSec >= simTimeSec, "The warm-up must end before the simulation");
+    if (warmUpSec > 0)
+    {
+        Simulator::Stop(Seconds(warmUpSec));
+        NS_LOG_INFO("Warming up...");
+        Simulator::Run();
+    }
+
+    // Every seed is branched into every interval: branch = seed index * nIntervals + interval index
+    uint32_t nIntervals = branchIntervals.size();
+    uint32_t nBranches = branches * nIntervals;
+    uint32_t branch = 0;
+    if (nBranches > 1)
+    {
+        branch = SimulatorCheckpoint::Branch(nBranches, branchParallel);
+        if (branch == SimulatorCheckpoint::PARENT)
+        {
+            // The snapshot itself has nothing to report: leave without flushing its output
+            uint32_t failed = SimulatorCheckpoint::GetFailedBranches();
+            std::cout << nBranches - failed << " of " << nBranches << " branches completed.\n";
+            return failed > 0 ? 1 : 0;
+        }
+
+        // Seed 0 keeps the random numbers of runSeed; the others draw theirs,
+        // from now on, from the substreams of their own run number
+        if (branch / nIntervals > 0)
+        {
+            RngSeedManager::SetRun(runSeed + branch / nIntervals);
+            RandomVariableStream::ResetAllStreams();
+        }
+    }
+    uint32_t seed = runSeed + branch / nIntervals;
+    double warmUpIntervalSec = intervalSec;
+    intervalSec = branchIntervals[branch % nIntervals];
+    if (intervalSec != warmUpIntervalSec)
+    {
+        for (auto it = senderApps.Begin(); it != senderApps.End(); ++it)
+        {
+            DynamicCast<PeriodicSender>(*it)->SetInterval(Seconds(intervalSec));
+        }
+    }
+
+    // Output directory
+    std::string timestamp = std::to_string(time(nullptr));
+    std::string outDir =
+        "results/" + experimentName +
+        "/run_" + std::to_string(seed) +
+        (nBranches > 1 ? "_b" + std::to_string(branch) : "") + "_" + timestamp + "/";
+
+    system(("mkdir -p " + outDir).c_str());
+
+    std::string energyFile  = outDir + "energy.csv";
+    std::string metaFile    = outDir + "metadata.json";
+    std::string metricsFile = outDir + "metrics.json";
+
+    energyRecorder->SetAttribute("FileName", StringValue(outDir + "energy.bin"));
+
     /****************
      *  Simulation  *
      ****************/
 
-    Simulator::Stop(Seconds(simTimeSec));
+    Simulator::Stop(Seconds(simTimeSec) - Simulator::Now());
     NS_LOG_INFO("Running simulation...");
     Simulator::Run();
+    double simulatedTimeSec = Simulator::Now().GetSeconds();
 
     // -------------- Metrics computation --------------
 
+    g_energyCsv.open(energyFile.c_str());
+    g_energyCsv << "time,node,remaining_energy_joules\n";
+
     // Energy: sum over all device energy models
     double totalEnergyConsumedJ = 0.0;
     uint32_t nodeId = 0;
@@ -432,7 +519,11 @@ int main(int argc, char* argv[])
         meta << "  \"intervalSec\": " << intervalSec << ",\n";
         meta << "  \"payloadBytes\": " << payloadBytes << ",\n";
         meta << "  \"environment\": \"" << environment << "\",\n";
-        meta << "  \"seed\": " << runSeed << "\n";
+        meta << "  \"warmUpSec\": " << warmUpSec << ",\n";
+        meta << "  \"warmUpIntervalSec\": " << warmUpIntervalSec << ",\n";
+        meta << "  \"branchOf\": " << runSeed << ",\n";
+        meta << "  \"branch\": " << branch << ",\n";
+        meta << "  \"seed\": " << seed << "\n";
         meta << "}\n";
     }
 
@@ -441,6 +532,17 @@ int main(int argc, char* argv[])
     {
         std::ofstream metrics(metricsFile.c_str());
         metrics << "{\n";
+        metrics << "  \"simulatedTimeSec\": " << simulatedTimeSec << ",\n";
+        metrics << "  \"converged\": " << (convergence->IsConverged() ? "true" : "false") << ",\n";
+        metrics << "  \"pdrHalfWidth\": ";
+        if (std::isfinite(convergence->GetPdrHalfWidth()))
+        {
+            metrics << convergence->GetPdrHalfWidth() << ",\n";
+        }
+        else
+        {
+            metrics << "null,\n";
+        }
         metrics << "  \"packetsSent\": " << g_packetsSent << ",\n";
         metrics << "  \"packetsReceived\": " << g_packetsReceived << ",\n";
         metrics << "  \"bytesPerPacket\": " << payloadBytes << ",\n";
@@ -494,32 +596,48 @@ int main(int argc, char* argv[])
         metrics << "  },\n";
 
         // ----------------------------------------------------------------------
-        // Serialize per-node average latency
+        // Serialize per-node latency statistics
         // ----------------------------------------------------------------------
-        metrics << "  \"nodeAverageLatency\": {\n";
-        {
+        auto writeNodeLatency = [&metrics](const std::string& name,
+                                           double (*stat)(const LogLinearHistogram&),
+                                           bool lastField) {
+            metrics << "  \"" << name << "\": {\n";
             size_t idx = 0;
             const size_t last = nodeLatencies.size();
 
             for (const auto& entry : nodeLatencies)
             {
                 int nodeId = entry.first;
-                std::vector<double> latencies = entry.second;
-
-                // for (double element : latencies) {
-                //     std::cout << element << " ";
-                // }
-                // std::cout << std::endl;
 
-                double sum = std::accumulate(latencies.begin(), latencies.end(), 0.0);
-                double averageLatency = sum / latencies.size();
-
-                metrics << "    \"" << nodeId << "\": " << averageLatency;
+                metrics << "    \"" << nodeId << "\": " << stat(entry.second);
                 if (++idx < last) metrics << ",";
                 metrics << "\n";
             }
+            metrics << (lastField ? "  }\n" : "  },\n");
+        };
+
+        writeNodeLatency("nodeAverageLatency",
+                         [](const LogLinearHistogram& h) { return h.GetMean(); },
+                         false);
+        writeNodeLatency("nodeLatencyP50",
+                         [](const LogLinearHistogram& h) { return h.GetQuantile(0.50); },
+                         false);
+        writeNodeLatency("nodeLatencyP95",
+                         [](const LogLinearHistogram& h) { return h.GetQuantile(0.95); },
+                         false);
+        writeNodeLatency("nodeLatencyP99",
+                         [](const LogLinearHistogram& h) { return h.GetQuantile(0.99); },
+                         false);
+
+        // Network-wide latency distribution, merged from the per-node sketches
+        LogLinearHistogram latency;
+        for (const auto& entry : nodeLatencies)
+        {
+            latency.Merge(entry.second);
         }
-        metrics << "  }\n";
+        metrics << "  \"latencyP50\": " << latency.GetQuantile(0.50) << ",\n";
+        metrics << "  \"latencyP95\": " << latency.GetQuantile(0.95) << ",\n";
+        metrics << "  \"latencyP99\": " << latency.GetQuantile(0.99) << "\n";
 
         metrics << "}\n";   // end object
     }
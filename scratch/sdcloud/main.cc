@@ -2,6 +2,7 @@
 #include "ns3/energy-module.h"
 #include "ns3/basic-energy-source.h"
 #include "ns3/basic-energy-source-helper.h"
+#include "ns3/energy-recorder-helper.h"
 #include "ns3/wifi-radio-energy-model-helper.h"
 #include "ns3/network-module.h"
 #include "ns3/mobility-module.h"
@@ -20,6 +21,10 @@
 #include "ns3/periodic-sender-helper.h"
 #include "ns3/mesh-helper.h"
 #include "ns3/mesh-module.h"
+#include "ns3/simulator-checkpoint.h"
+
+#include <sstream>
+#include <vector>
 
 
 using namespace ns3;
@@ -28,24 +33,14 @@ using namespace lorawan;
 
 static std::ofstream g_energyCsv;
 
-// static void RemainingEnergyTrace(uint32_t nodeId, double oldValue, double newValue)
-// {
-    // nodeEnergyRemaining[nodeId] = newValue;
-    // g_energyCsv << Simulator::Now().GetSeconds() << ","
-    //             << nodeId << ","
-    //             << newValue << std::endl;
-// }
-
 DeviceEnergyModelContainer SetupEnergyModel(
     NodeContainer& nodes, 
     NetDeviceContainer& devices, 
-    const std::string& filename, 
+    Ptr<EnergyRecorder>& recorder,
+    double seriesResolutionSec,
     const std::string& technology, 
     const std::string& topology)
 {
-    g_energyCsv.open(filename);
-    g_energyCsv << "time,node,remaining_energy_joules\n";
-
     BasicEnergySourceHelper sourceHelper;
     sourceHelper.Set("BasicEnergySourceInitialEnergyJ", DoubleValue(300.0));
 
@@ -96,14 +91,12 @@ DeviceEnergyModelContainer SetupEnergyModel(
         NS_FATAL_ERROR("Unsupported technology: " << technology);
     }
 
-    // for (uint32_t i = 0; i < sources.GetN(); i++)
-    // {
-    //     Ptr<EnergySource> src = sources.Get(i);
-    //     src->TraceConnectWithoutContext(
-    //         "RemainingEnergy",
-    //         MakeBoundCallback(&RemainingEnergyTrace, i)
-    //     );
-    // }
+    // Trace remaining energy over time, decimated and written in bulk; the
+    // samples stay in memory until the output folder, hence the file name, is known
+    EnergyRecorderHelper recorderHelper;
+    recorderHelper.SetRecorderAttribute("FileName", StringValue(""));
+    recorderHelper.SetRecorderAttribute("Resolution", TimeValue(Seconds(seriesResolutionSec)));
+    recorder = recorderHelper.Install(sources);
 
     return models;
 }
@@ -275,12 +268,17 @@ int main(int argc, char *argv[])
     uint16_t serverPort   = 9;
     double   txPowerDbm   = 15.0;
     bool     verbose      = false;
+    double   energyResolutionSec = 1.0; // energy time-series resolution (s)
 
     std::string experimentName = "default";
     std::string environment = "field"; // field | forest | mountain
     std::string technology = "wifi";  // currently only wifi supported | ble | lora
     std::string topology = "star";  // star | mesh
     uint32_t runSeed = 1;
+    double warmUpSec = 0.0;          // simulated time shared by all branches (s)
+    uint32_t branches = 1;           // seeds branched from the warmed-up state
+    uint32_t branchParallel = 1;     // branches running at the same time
+    std::string branchIntervalsSec;  // send intervals branched after the warm-up (s)
 
     CommandLine cmd;
     // USE SAME NUMBER OF DEVICES ON ALL SIMULATIONS
@@ -292,15 +290,42 @@ int main(int argc, char *argv[])
     cmd.AddValue("serverPort", "UDP server port on cloud", serverPort);
     cmd.AddValue("txPowerDbm", "Wi-Fi TX power (dBm)", txPowerDbm);
     cmd.AddValue("verbose", "Enable UdpClient/Server INFO logs", verbose);
+    cmd.AddValue("energyResolutionSec",
+                 "Minimum time between two samples of the energy time series (s)",
+                 energyResolutionSec);
 
     cmd.AddValue("experimentName", "Experiment folder name", experimentName);
     cmd.AddValue("environment", "Environment: field | forest | mountain", environment);
     cmd.AddValue("technology", "Technology: wifi (BLE/LoRa future)", technology);
     cmd.AddValue("topology", "Topology: star | mesh", topology);
     cmd.AddValue("runSeed", "Run number / RNG seed", runSeed);
+    cmd.AddValue("warmUpSec",
+                 "Simulated time run once, before branching into the seeds (s)",
+                 warmUpSec);
+    cmd.AddValue("branches",
+                 "Number of seeds (runSeed, runSeed + 1, ...) branched after the warm-up",
+                 branches);
+    cmd.AddValue("branchParallel", "Maximum number of branches running at once", branchParallel);
+    cmd.AddValue("branchIntervalsSec",
+                 "Comma-separated send intervals each seed is branched into after the warm-up (s)",
+                 branchIntervalsSec);
 
     cmd.Parse(argc, argv);
 
+    std::vector<double> branchIntervals;
+    {
+        std::istringstream list(branchIntervalsSec);
+        std::string item;
+        while (std::getline(list, item, ','))
+        {
+            branchIntervals.push_back(std::stod(item));
+        }
+    }
+    if (branchIntervals.empty())
+    {
+        branchIntervals.push_back(intervalSec);
+    }
+
     if (technology != "wifi")
     {
         NS_FATAL_ERROR("Only wifi is implemented at the moment.");
@@ -320,19 +345,6 @@ int main(int argc, char *argv[])
     RngSeedManager::SetSeed(1);
     RngSeedManager::SetRun(runSeed);
 
-    std::string timestamp = std::to_string(time(NULL));
-
-    std::string outDir = 
-        "results/" + experimentName + 
-        "/run_" + std::to_string(runSeed) + "_" + timestamp + "/";
-
-    system(("mkdir -p " + outDir).c_str());
-
-    std::string flowmonFile = outDir + "flowmon.xml";
-    std::string energyFile = outDir + "energy.csv";
-    std::string metaFile = outDir + "metadata.json";
-
-
     if (verbose)
     {
         LogComponentEnable("UdpClient", LOG_LEVEL_INFO);
@@ -425,7 +437,13 @@ int main(int argc, char *argv[])
     NodeContainer energyNodes;
     energyNodes.Add(sensors);
 
-    DeviceEnergyModelContainer deviceEnergyModels = SetupEnergyModel(energyNodes, staDevs, energyFile, technology, topology);
+    Ptr<EnergyRecorder> energyRecorder;
+    DeviceEnergyModelContainer deviceEnergyModels = SetupEnergyModel(energyNodes,
+                                                                      staDevs,
+                                                                      energyRecorder,
+                                                                      energyResolutionSec,
+                                                                      technology,
+                                                                      topology);
 
     // ---------------- Applications ----------------
     UdpServerHelper server(serverPort);
@@ -441,6 +459,7 @@ int main(int argc, char *argv[])
     client.SetAttribute("Interval", TimeValue(Seconds(intervalSec)));
     client.SetAttribute("PacketSize", UintegerValue(payloadBytes));
 
+    ApplicationContainer clientApps;
     Ptr<UniformRandomVariable> jitter = CreateObject<UniformRandomVariable>();
     jitter->SetAttribute("Min", DoubleValue(0.0));
     jitter->SetAttribute("Max", DoubleValue(0.5));
@@ -448,6 +467,7 @@ int main(int argc, char *argv[])
     for (uint32_t i = 0; i < nDevices; ++i)
     {
         ApplicationContainer apps = client.Install(sensors.Get(i));
+        clientApps.Add(apps);
         // double start = 2.0 + i * 0.25;
         double start = 2.0 + jitter->GetValue();
         apps.Start(Seconds(start));
@@ -459,12 +479,69 @@ int main(int argc, char *argv[])
     FlowMonitorHelper fmHelper;
     Ptr<FlowMonitor> monitor = fmHelper.InstallAll();
 
+    // ---------------- Warm-up and branching ----------------
+    NS_ABORT_MSG_IF(warmUpSec >= simTimeSec, "The warm-up must end before the simulation");
+    if (warmUpSec > 0)
+    {
+        Simulator::Stop(Seconds(warmUpSec));
+        Simulator::Run();
+    }
+
+    // Every seed is branched into every interval: branch = seed index * nIntervals + interval index
+    uint32_t nIntervals = branchIntervals.size();
+    uint32_t nBranches = branches * nIntervals;
+    uint32_t branch = 0;
+    if (nBranches > 1)
+    {
+        branch = SimulatorCheckpoint::Branch(nBranches, branchParallel);
+        if (branch == SimulatorCheckpoint::PARENT)
+        {
+            uint32_t failed = SimulatorCheckpoint::GetFailedBranches();
+            std::cout << nBranches - failed << " of " << nBranches << " branches completed.\n";
+            return failed > 0 ? 1 : 0;
+        }
+        if (branch / nIntervals > 0)
+        {
+            RngSeedManager::SetRun(runSeed + branch / nIntervals);
+            RandomVariableStream::ResetAllStreams();
+        }
+    }
+    uint32_t seed = runSeed + branch / nIntervals;
+    double warmUpIntervalSec = intervalSec;
+    intervalSec = branchIntervals[branch % nIntervals];
+    if (intervalSec != warmUpIntervalSec)
+    {
+        // Takes effect from the next packet of every client
+        for (auto it = clientApps.Begin(); it != clientApps.End(); ++it)
+        {
+            (*it)->SetAttribute("Interval", TimeValue(Seconds(intervalSec)));
+        }
+    }
+
+    std::string timestamp = std::to_string(time(NULL));
+
+    std::string outDir = 
+        "results/" + experimentName + 
+        "/run_" + std::to_string(seed) +
+        (nBranches > 1 ? "_b" + std::to_string(branch) : "") + "_" + timestamp + "/";
+
+    system(("mkdir -p " + outDir).c_str());
+
+    std::string flowmonFile = outDir + "flowmon.xml";
+    std::string energyFile = outDir + "energy.csv";
+    std::string metaFile = outDir + "metadata.json";
+
+    energyRecorder->SetAttribute("FileName", StringValue(outDir + "energy.bin"));
+
     // ---------------- Run ----------------
-    Simulator::Stop(Seconds(simTimeSec));
+    Simulator::Stop(Seconds(simTimeSec) - Simulator::Now());
     Simulator::Run();
 
     monitor->SerializeToXmlFile(flowmonFile, false, false);
 
+    g_energyCsv.open(energyFile);
+    g_energyCsv << "time,node,remaining_energy_joules\n";
+
     uint32_t nodeId = 0;
     for (auto iter = deviceEnergyModels.Begin(); iter != deviceEnergyModels.End(); iter++, ++nodeId)
     {
@@ -488,7 +565,11 @@ int main(int argc, char *argv[])
     meta << "  \"simTimeSec\": " << simTimeSec << ",\n";
     meta << "  \"payloadBytes\": " << payloadBytes << ",\n";
     meta << "  \"intervalSec\": " << intervalSec << ",\n";
-    meta << "  \"seed\": " << runSeed << "\n";
+    meta << "  \"warmUpSec\": " << warmUpSec << ",\n";
+    meta << "  \"warmUpIntervalSec\": " << warmUpIntervalSec << ",\n";
+    meta << "  \"branchOf\": " << runSeed << ",\n";
+    meta << "  \"branch\": " << branch << ",\n";
+    meta << "  \"seed\": " << seed << "\n";
     meta << "}\n";
     meta.close();
 
@@ -42,6 +42,7 @@ DefaultSimulatorImpl::GetTypeId()
 }
 
 DefaultSimulatorImpl::DefaultSimulatorImpl()
+    : m_inbox(INBOX_SIZE)
 {
     NS_LOG_FUNCTION(this);
     m_stop = false;
@@ -142,10 +143,36 @@ DefaultSimulatorImpl::IsFinished() const
     return m_events->IsEmpty() || m_stop;
 }
 
+void
+DefaultSimulatorImpl::InsertEventWithContext(const EventWithContext& event)
+{
+    Scheduler::Event ev;
+    ev.impl = event.event;
+    ev.key.m_ts = m_currentTs + event.timestamp;
+    ev.key.m_context = event.context;
+    ev.key.m_uid = m_uid;
+    m_uid++;
+    m_unscheduledEvents++;
+    m_events->Insert(ev);
+}
+
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    bool overflowEmpty = m_eventsWithContextEmpty.load(std::memory_order_acquire);
+    if (overflowEmpty && m_inbox.IsEmpty())
+    {
+        return;
+    }
+
+    // The inbox first: as long as a thread has events in the overflow
+    // list, its later events go there too, so this keeps its order
+    EventWithContext event;
+    while (m_inbox.Pop(event))
+    {
+        InsertEventWithContext(event);
+    }
+    if (overflowEmpty)
     {
         return;
     }
@@ -155,20 +182,12 @@ DefaultSimulatorImpl::ProcessEventsWithContext()
     {
         std::unique_lock lock{m_eventsWithContextMutex};
         m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        m_eventsWithContextEmpty.store(true, std::memory_order_release);
     }
     while (!eventsWithContext.empty())
     {
-        EventWithContext event = eventsWithContext.front();
+        InsertEventWithContext(eventsWithContext.front());
         eventsWithContext.pop_front();
-        Scheduler::Event ev;
-        ev.impl = event.event;
-        ev.key.m_ts = m_currentTs + event.timestamp;
-        ev.key.m_context = event.context;
-        ev.key.m_uid = m_uid;
-        m_uid++;
-        m_unscheduledEvents++;
-        m_events->Insert(ev);
     }
 }
 
@@ -253,10 +272,14 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         // Current time added in ProcessEventsWithContext()
         ev.timestamp = delay.GetTimeStep();
         ev.event = event;
+        if (m_eventsWithContextEmpty.load(std::memory_order_acquire) && m_inbox.Push(ev))
+        {
+            return;
+        }
         {
             std::unique_lock lock{m_eventsWithContextMutex};
             m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
+            m_eventsWithContextEmpty.store(false, std::memory_order_release);
         }
     }
 }
@@ -9,8 +9,10 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "mpsc-ring.h"
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <thread>
@@ -86,16 +88,34 @@ class DefaultSimulatorImpl : public SimulatorImpl
         EventImpl* event;
     };
 
+    /**
+     * Insert an event from a different context into the main event queue.
+     *
+     * @param [in] event The event.
+     */
+    void InsertEventWithContext(const EventWithContext& event);
+
+    /** Number of events from other threads the lock-free inbox can hold. */
+    static constexpr uint32_t INBOX_SIZE = 4096;
+    /**
+     * Lock-free inbox of the events scheduled from other threads.
+     *
+     * When it is full, or as long as older events of the overflow list
+     * have not been processed, events go to m_eventsWithContext instead.
+     */
+    MpscRing<EventWithContext> m_inbox;
+
     /** Container type for the events from a different context. */
     typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
+    /** The overflow list of events from a different context. */
     EventsWithContext m_eventsWithContext;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * Flag \c true if the overflow list is empty, i.e. all events with
+     * context that did not fit in m_inbox have been moved to the primary
+     * event queue.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
+    std::atomic<bool> m_eventsWithContextEmpty;
+    /** Mutex to control access to the overflow list of events with context. */
     std::mutex m_eventsWithContextMutex;
 
     /** Container type for the events to run at Simulator::Destroy() */
@@ -108,9 +128,9 @@ class DefaultSimulatorImpl : public SimulatorImpl
     Ptr<Scheduler> m_events;
 
     /** Next event unique id. */
-    uint32_t m_uid;
+    uint64_t m_uid;
     /** Unique id of the current event. */
-    uint32_t m_currentUid;
+    uint64_t m_currentUid;
     /** Timestamp of the current event. */
     uint64_t m_currentTs;
     /** Execution context of the current event. */
@@ -8,6 +8,7 @@
 
 #include "event-impl.h"
 
+#include "event-pool.h"
 #include "log.h"
 
 /**
@@ -32,6 +33,18 @@ EventImpl::EventImpl()
     NS_LOG_FUNCTION(this);
 }
 
+void*
+EventImpl::operator new(std::size_t size)
+{
+    return EventPool::Allocate(size);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    EventPool::Deallocate(p, size);
+}
+
 void
 EventImpl::Invoke()
 {
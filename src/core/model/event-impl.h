@@ -10,6 +10,7 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
 #include <stdint.h>
 
 /**
@@ -38,6 +39,18 @@ class EventImpl : public SimpleRefCount<EventImpl>
     EventImpl();
     /** Destructor. */
     virtual ~EventImpl() = 0;
+    /**
+     * Allocate an event from the EventPool.
+     * @param [in] size The size of the event object.
+     * @returns The memory of the event.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Return the memory of an event to the EventPool.
+     * @param [in] p The memory of the event.
+     * @param [in] size The size of the event object.
+     */
+    static void operator delete(void* p, std::size_t size);
     /**
      * Called by the simulation engine to notify the event that it is time
      * to execute.
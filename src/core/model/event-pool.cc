@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "event-pool.h"
+
+#include <array>
+#include <atomic>
+#include <new>
+
+/**
+ * @file
+ * @ingroup events
+ * ns3::EventPool implementation.
+ */
+
+namespace ns3
+{
+
+namespace
+{
+
+/** Size class granularity, in bytes. */
+constexpr std::size_t GRANULARITY = 16;
+/** Number of size classes: blocks of up to 256 bytes are pooled. */
+constexpr std::size_t N_CLASSES = 16;
+/** Maximum number of free blocks kept per size class and thread. */
+constexpr std::size_t MAX_FREE = 4096;
+
+/** A free block, linked to the next free block of its size class. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< Next free block
+};
+
+/** Set when the free lists of the thread have been released. */
+thread_local bool t_released = false;
+
+/** Free lists and counters of one thread. */
+struct ThreadPool
+{
+    std::array<FreeBlock*, N_CLASSES> heads{}; //!< Free list heads, by size class
+    std::array<std::size_t, N_CLASSES> free{}; //!< Free list lengths, by size class
+    EventPool::Stats stats{};                  //!< Allocation counters
+
+    /** Release the free blocks on thread exit. */
+    ~ThreadPool()
+    {
+        for (auto head : heads)
+        {
+            while (head)
+            {
+                FreeBlock* next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+        }
+        t_released = true;
+    }
+};
+
+/** Free lists of the thread. */
+thread_local ThreadPool t_pool;
+
+/** Whether freed blocks are reused. */
+std::atomic<bool> g_enabled{true};
+
+} // unnamed namespace
+
+void*
+EventPool::Allocate(std::size_t size)
+{
+    std::size_t cls = (size + GRANULARITY - 1) / GRANULARITY - 1;
+    if (t_released)
+    {
+        return ::operator new(cls < N_CLASSES ? (cls + 1) * GRANULARITY : size);
+    }
+
+    ThreadPool& pool = t_pool;
+    ++pool.stats.allocations;
+    if (cls >= N_CLASSES)
+    {
+        ++pool.stats.heapAllocations;
+        return ::operator new(size);
+    }
+    FreeBlock* block = pool.heads[cls];
+    if (block && g_enabled.load(std::memory_order_relaxed))
+    {
+        pool.heads[cls] = block->next;
+        --pool.free[cls];
+        return block;
+    }
+    ++pool.stats.heapAllocations;
+    return ::operator new((cls + 1) * GRANULARITY);
+}
+
+void
+EventPool::Deallocate(void* p, std::size_t size)
+{
+    std::size_t cls = (size + GRANULARITY - 1) / GRANULARITY - 1;
+    if (t_released || cls >= N_CLASSES || !g_enabled.load(std::memory_order_relaxed))
+    {
+        ::operator delete(p);
+        return;
+    }
+
+    ThreadPool& pool = t_pool;
+    if (pool.free[cls] >= MAX_FREE)
+    {
+        ::operator delete(p);
+        return;
+    }
+    auto block = static_cast<FreeBlock*>(p);
+    block->next = pool.heads[cls];
+    pool.heads[cls] = block;
+    ++pool.free[cls];
+}
+
+void
+EventPool::SetEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool
+EventPool::IsEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+EventPool::Stats
+EventPool::GetStats()
+{
+    return t_released ? Stats{0, 0} : t_pool.stats;
+}
+
+void
+EventPool::ResetStats()
+{
+    if (!t_released)
+    {
+        t_pool.stats = Stats{0, 0};
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file
+ * @ingroup events
+ * ns3::EventPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup events
+ * @brief Size-classed free-list allocator for simulation events.
+ *
+ * Every EventImpl, and hence every event created by MakeEvent() for
+ * Simulator::Schedule() and friends, is allocated from this pool. Sizes are
+ * rounded up to a multiple of 16 bytes. A freed block of up to 256 bytes is
+ * kept on the free list of its size class and handed out again by the next
+ * allocation of that class, so that a simulation in steady state no longer
+ * calls the global allocator for its events. Larger events, and blocks
+ * freed while their free list is full, go to the global allocator.
+ *
+ * The free lists belong to the calling thread, so no locking is needed; a
+ * block allocated by one thread may be freed by another one. The lists of a
+ * thread are released when it exits.
+ */
+class EventPool
+{
+  public:
+    /** Allocation counters of the calling thread. */
+    struct Stats
+    {
+        uint64_t allocations;     //!< Number of events allocated
+        uint64_t heapAllocations; //!< Number of those taken from the global allocator
+    };
+
+    /**
+     * @brief Allocate memory for an event.
+     * @param [in] size The size of the event object.
+     * @return The allocated memory.
+     */
+    static void* Allocate(std::size_t size);
+
+    /**
+     * @brief Free the memory of an event.
+     * @param [in] p The memory returned by Allocate().
+     * @param [in] size The size of the event object.
+     */
+    static void Deallocate(void* p, std::size_t size);
+
+    /**
+     * @brief Enable or disable the reuse of freed blocks.
+     *
+     * While disabled, every allocation and deallocation goes to the global
+     * allocator. Blocks can be freed whatever the setting was when they
+     * were allocated. Enabled by default.
+     *
+     * @param [in] enabled Whether to reuse freed blocks.
+     */
+    static void SetEnabled(bool enabled);
+
+    /**
+     * @brief Check whether freed blocks are reused.
+     * @return \c true if freed blocks are reused.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Get the allocation counters of the calling thread.
+     * @return The counters.
+     */
+    static Stats GetStats();
+
+    /** @brief Reset the allocation counters of the calling thread. */
+    static void ResetStats();
+};
+
+} // namespace ns3
+
+#endif /* EVENT_POOL_H */
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+#include "assert.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file
+ * @ingroup core
+ * ns3::MpscRing declaration and template implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup core
+ * @brief A bounded, lock-free, multiple producer, single consumer queue.
+ *
+ * Any number of threads may Push() concurrently, while a single thread
+ * Pop()s. Each slot carries a sequence number telling whether it is free
+ * for the producer of a given position or holds an item for the consumer
+ * (D. Vyukov's bounded queue): a producer claims a position with a single
+ * compare-and-swap, then publishes its item with a release store, and the
+ * consumer needs no atomic read-modify-write at all.
+ *
+ * Items of a given producer are popped in the order it pushed them.
+ *
+ * @tparam T The item type, which must be default constructible and copyable.
+ */
+template <typename T>
+class MpscRing
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param [in] capacity The number of slots, a power of two.
+     */
+    explicit MpscRing(uint32_t capacity);
+
+    /**
+     * Append an item, from any thread.
+     *
+     * @param [in] item The item.
+     * @returns \c false, without waiting, if the ring is full.
+     */
+    bool Push(const T& item);
+
+    /**
+     * Take the oldest item, from the consumer thread only.
+     *
+     * @param [out] item The item.
+     * @returns \c false if the ring is empty.
+     */
+    bool Pop(T& item);
+
+    /**
+     * Whether the ring looks empty, from the consumer thread only.
+     *
+     * An item being pushed concurrently may be missed.
+     *
+     * @returns \c true if there is nothing to Pop().
+     */
+    bool IsEmpty() const;
+
+  private:
+    /** A slot of the ring. */
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence; //!< Position the slot is ready for.
+        T item;                         //!< The item.
+    };
+
+    const uint64_t m_mask;           //!< Capacity - 1.
+    std::unique_ptr<Slot[]> m_slots; //!< The ring.
+    /** Next position to push to, shared by the producers. */
+    alignas(64) std::atomic<uint64_t> m_enqueuePos;
+    /** Next position to pop from, owned by the consumer. */
+    alignas(64) uint64_t m_dequeuePos;
+};
+
+/*************************************************
+ **  Template implementation
+ ************************************************/
+
+template <typename T>
+MpscRing<T>::MpscRing(uint32_t capacity)
+    : m_mask(capacity - 1),
+      m_slots(new Slot[capacity]),
+      m_enqueuePos(0),
+      m_dequeuePos(0)
+{
+    NS_ASSERT_MSG(capacity >= 2 && (capacity & (capacity - 1)) == 0,
+                  "MpscRing capacity must be a power of two");
+    for (uint64_t i = 0; i < capacity; ++i)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool
+MpscRing<T>::Push(const T& item)
+{
+    uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+        slot = &m_slots[pos & m_mask];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence - pos);
+        if (diff == 0)
+        {
+            // The slot is free for this position: try to claim it
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the item pushed one lap earlier
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->item = item;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool
+MpscRing<T>::Pop(T& item)
+{
+    Slot& slot = m_slots[m_dequeuePos & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+    {
+        return false;
+    }
+    item = slot.item;
+    // Free the slot for the producer of the next lap
+    slot.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
+    return true;
+}
+
+template <typename T>
+bool
+MpscRing<T>::IsEmpty() const
+{
+    const Slot& slot = m_slots[m_dequeuePos & m_mask];
+    return slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1;
+}
+
+} // namespace ns3
+
+#endif /* MPSC_RING_H */
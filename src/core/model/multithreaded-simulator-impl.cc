@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "log.h"
+#include "scheduler.h"
+#include "simulator.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <barrier>
+#include <limits>
+#include <thread>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+thread_local MultithreadedSimulatorImpl::Partition* MultithreadedSimulatorImpl::t_partition =
+    nullptr;
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("ThreadCount",
+                          "The number of threads, and of node partitions; 0 for one per "
+                          "hardware thread. Only taken into account when the simulator "
+                          "is created, so set it with Config::SetDefault.",
+                          TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_threadCount),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("Lookahead",
+                          "The smallest delay of an event scheduled by a node for a node of "
+                          "another partition, typically ChannelList::GetMinimumDelay(). "
+                          "Required with more than one thread.",
+                          TimeValue(Time(0)),
+                          MakeTimeAccessor(&MultithreadedSimulatorImpl::m_lookahead),
+                          MakeTimeChecker(Time(0)));
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+    : m_threadCount(0),
+      m_global(nullptr),
+      m_windowEnd(0),
+      m_stop(false),
+      m_done(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& partition : m_partitions)
+    {
+        for (auto& outbox : partition.outboxes)
+        {
+            for (const auto& pending : outbox)
+            {
+                pending.event->Unref();
+            }
+            outbox.clear();
+        }
+        while (!partition.events->IsEmpty())
+        {
+            Scheduler::Event next = partition.events->RemoveNext();
+            next.impl->Unref();
+        }
+        partition.events = nullptr;
+    }
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+
+    if (m_partitions.empty())
+    {
+        if (m_threadCount == 0)
+        {
+            m_threadCount = std::max(1U, std::thread::hardware_concurrency());
+        }
+        // The node partitions, then the global one
+        m_partitions.resize(m_threadCount + 1);
+        for (auto& partition : m_partitions)
+        {
+            partition.uid = EventId::UID::VALID;
+            partition.currentUid = EventId::UID::INVALID;
+            partition.currentTs = 0;
+            partition.currentContext = Simulator::NO_CONTEXT;
+            partition.eventCount = 0;
+            partition.stop = false;
+            partition.outboxes.resize(m_threadCount + 1);
+        }
+        m_global = &m_partitions.back();
+    }
+
+    for (auto& partition : m_partitions)
+    {
+        Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+        if (partition.events)
+        {
+            while (!partition.events->IsEmpty())
+            {
+                scheduler->Insert(partition.events->RemoveNext());
+            }
+        }
+        partition.events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartition(uint32_t context) const
+{
+    return context == Simulator::NO_CONTEXT ? m_threadCount : context % m_threadCount;
+}
+
+MultithreadedSimulatorImpl::Partition&
+MultithreadedSimulatorImpl::Current() const
+{
+    return t_partition ? *t_partition : *m_global;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::NextTs(const Partition& partition)
+{
+    return partition.events->IsEmpty() ? std::numeric_limits<uint64_t>::max()
+                                       : partition.events->PeekNext().key.m_ts;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::Insert(Partition& partition,
+                                   uint32_t context,
+                                   uint64_t ts,
+                                   EventImpl* event)
+{
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = partition.uid;
+    partition.uid++;
+    partition.events->Insert(ev);
+    return ev.key.m_uid;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent(Partition& partition)
+{
+    Scheduler::Event next = partition.events->RemoveNext();
+
+    PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+    NS_ASSERT(next.key.m_ts >= partition.currentTs);
+    partition.eventCount++;
+
+    partition.currentTs = next.key.m_ts;
+    partition.currentContext = next.key.m_context;
+    partition.currentUid = next.key.m_uid;
+    next.impl->Invoke();
+    next.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(Partition& partition)
+{
+    while (!partition.stop && !partition.events->IsEmpty() &&
+           partition.events->PeekNext().key.m_ts < m_windowEnd)
+    {
+        ProcessOneEvent(partition);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Synchronize()
+{
+    // Deliver the events exchanged during the window
+    for (auto& source : m_partitions)
+    {
+        for (uint32_t index = 0; index < source.outboxes.size(); ++index)
+        {
+            for (const auto& pending : source.outboxes[index])
+            {
+                Insert(m_partitions[index], pending.context, pending.ts, pending.event);
+            }
+            source.outboxes[index].clear();
+        }
+    }
+
+    // The global events run alone, in the global partition
+    Partition* previous = t_partition;
+    t_partition = m_global;
+    while (true)
+    {
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        for (uint32_t index = 0; index < m_threadCount; ++index)
+        {
+            next = std::min(next, NextTs(m_partitions[index]));
+        }
+        uint64_t nextGlobal = NextTs(*m_global);
+
+        if (m_stop.load(std::memory_order_relaxed) ||
+            (next == std::numeric_limits<uint64_t>::max() && m_global->events->IsEmpty()))
+        {
+            m_done = true;
+            break;
+        }
+        if (!m_global->events->IsEmpty() && nextGlobal <= next)
+        {
+            ProcessOneEvent(*m_global);
+            continue;
+        }
+
+        // A single partition exchanges events with the global one only,
+        // which never runs concurrently
+        uint64_t lookahead = m_threadCount > 1 ? m_lookahead.GetTimeStep()
+                                               : std::numeric_limits<uint64_t>::max();
+        m_windowEnd = next > std::numeric_limits<uint64_t>::max() - lookahead
+                          ? std::numeric_limits<uint64_t>::max()
+                          : next + lookahead;
+        m_windowEnd = std::min(m_windowEnd, nextGlobal);
+        break;
+    }
+    t_partition = previous;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& partition : m_partitions)
+    {
+        if (!partition.events->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(t_partition == nullptr, "Simulator::Run called from an event");
+    NS_ABORT_MSG_IF(m_threadCount > 1 && !m_lookahead.IsStrictlyPositive(),
+                    "MultithreadedSimulatorImpl needs a positive Lookahead with "
+                        << m_threadCount << " threads");
+
+    m_stop = false;
+    for (auto& partition : m_partitions)
+    {
+        partition.stop = false;
+    }
+    m_done = false;
+    Synchronize();
+
+    if (!m_done)
+    {
+        auto synchronize = [this]() noexcept { Synchronize(); };
+        std::barrier barrier(m_threadCount, synchronize);
+        auto work = [this, &barrier](uint32_t index) {
+            t_partition = &m_partitions[index];
+            while (!m_done)
+            {
+                ProcessWindow(*t_partition);
+                barrier.arrive_and_wait();
+            }
+            t_partition = nullptr;
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t index = 1; index < m_threadCount; ++index)
+        {
+            threads.emplace_back(work, index);
+        }
+        work(0);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Simulator::Now() from main, until the next run
+    for (uint32_t index = 0; index < m_threadCount; ++index)
+    {
+        m_global->currentTs = std::max(m_global->currentTs, m_partitions[index].currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    Current().stop = true;
+    m_stop = true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    return Simulator::Schedule(delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep() << event);
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+
+    Partition& partition = Current();
+    uint64_t ts = partition.currentTs + delay.GetTimeStep();
+    uint64_t uid = Insert(partition, partition.currentContext, ts, event);
+    return EventId(event, ts, partition.currentContext, uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_LOG_FUNCTION(this << context << delay.GetTimeStep() << event);
+    NS_ASSERT_MSG(delay.IsPositive(),
+                  "MultithreadedSimulatorImpl::ScheduleWithContext(): Negative delay");
+
+    Partition& source = Current();
+    uint64_t ts = source.currentTs + delay.GetTimeStep();
+    uint32_t index = GetPartition(context);
+    Partition& destination = m_partitions[index];
+
+    if (&source == &destination || &source == m_global)
+    {
+        // Same thread, or all the other threads wait at the barrier
+        Insert(destination, context, ts, event);
+        return;
+    }
+    NS_ABORT_MSG_IF(ts < m_windowEnd,
+                    "Event for context " << context << " scheduled " << delay.As(Time::NS)
+                                         << " ahead, within the lookahead "
+                                         << m_lookahead.As(Time::NS)
+                                         << " of MultithreadedSimulatorImpl");
+    source.outboxes[index].push_back({context, ts, event});
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    NS_ASSERT_MSG(&Current() == m_global,
+                  "Simulator::ScheduleDestroy called from an event of a node partition");
+
+    EventId id(Ptr<EventImpl>(event, false), m_global->currentTs, 0xffffffff, EventId::UID::DESTROY);
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return TimeStep(Current().currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    else
+    {
+        return TimeStep(id.GetTs() - Current().currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    m_partitions[GetPartition(id.GetContext())].events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    // The uids and the current event are those of the partition of the event
+    const Partition& partition = m_partitions[GetPartition(id.GetContext())];
+    return id.PeekEventImpl() == nullptr || id.GetTs() < partition.currentTs ||
+           (id.GetTs() == partition.currentTs && id.GetUid() <= partition.currentUid) ||
+           id.PeekEventImpl()->IsCancelled();
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return Current().currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& partition : m_partitions)
+    {
+        count += partition.eventCount;
+    }
+    return count;
+}
+
+} // namespace ns3
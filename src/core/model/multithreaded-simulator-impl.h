@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "nstime.h"
+#include "object-factory.h"
+#include "simulator-impl.h"
+
+#include <atomic>
+#include <list>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+// Forward
+class Scheduler;
+
+/**
+ * @ingroup simulator
+ *
+ * @brief A shared-memory parallel simulator implementation, which runs the
+ * nodes of a single process on several threads.
+ *
+ * Every event belongs to the partition of its context: the events of
+ * node \c n, i.e. of context \c n, belong to partition \c n modulo the
+ * ThreadCount attribute, each with its own event queue and its own
+ * thread. The events without context (Simulator::NO_CONTEXT, such as those
+ * scheduled from \c main before Simulator::Run) form a global partition.
+ *
+ * The partitions run in conservative windows: if \c t is the time of
+ * the earliest pending event, every partition processes, in parallel, its
+ * events earlier than \c t plus the Lookahead attribute, and the threads
+ * then meet at a barrier. An event a partition schedules for another one, with
+ * Simulator::ScheduleWithContext, is appended to a queue of the sending
+ * thread, without locking nor serialising anything, and moved into the
+ * destination partition at the barrier. This is correct as long as no
+ * such event is scheduled less than the lookahead ahead, which holds if
+ * the nodes only interact through channels and the lookahead is the
+ * smallest channel delay, ChannelList::GetMinimumDelay(). A violation is
+ * a fatal error. The events of the global partition run alone, between two
+ * windows: they may touch any node.
+ *
+ * Since the windows only depend on the event times, a simulation runs the
+ * same events in the same order whatever the number of threads, within
+ * each node.
+ *
+ * The objects shared by nodes of different partitions, packets included,
+ * see concurrent reference count updates. ns-3 must then be configured
+ * with \c NS3_MTP (\c --enable-mtp), which makes the reference counts
+ * atomic and the packet buffers safe to share between threads. The models
+ * must not otherwise share mutable state between nodes, nor use the
+ * EventId of an event of another partition, and trace sinks connected to
+ * several nodes must be thread-safe. Events, allocated from the EventPool
+ * of the thread which schedules them, return to the pool of the thread
+ * which runs them.
+ *
+ * Simulator::Stop() called by an event of a partition ends the simulation
+ * at the end of the current window, after that partition has stopped.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Get the partition, hence the thread, which runs the events of a
+     * context.
+     *
+     * @param [in] context The context.
+     * @returns The partition index, the number of threads for the global one.
+     */
+    uint32_t GetPartition(uint32_t context) const;
+
+  private:
+    void DoDispose() override;
+
+    /** An event scheduled for another partition, waiting for the barrier. */
+    struct PendingEvent
+    {
+        uint32_t context; //!< The event context.
+        uint64_t ts;      //!< The absolute event timestamp.
+        EventImpl* event; //!< The event implementation.
+    };
+
+    /**
+     * The state of a partition, written by its thread only while the
+     * window runs. Aligned so that partitions do not share cache lines.
+     */
+    struct alignas(64) Partition
+    {
+        Ptr<Scheduler> events;   //!< The event priority queue.
+        uint64_t uid;            //!< Next event unique id.
+        uint64_t currentUid;     //!< Unique id of the current event.
+        uint64_t currentTs;      //!< Timestamp of the current event.
+        uint32_t currentContext; //!< Execution context of the current event.
+        uint64_t eventCount;     //!< The event count.
+        bool stop;               //!< Simulator::Stop() called by an event.
+        /** Events scheduled for the other partitions, by destination. */
+        std::vector<std::vector<PendingEvent>> outboxes;
+    };
+
+    /**
+     * The partition of the calling thread: the one it runs, or the global
+     * partition.
+     *
+     * @returns The partition.
+     */
+    Partition& Current() const;
+
+    /**
+     * Insert an event into a partition, with a new uid of that partition.
+     *
+     * @param [in] partition The partition.
+     * @param [in] context The event context.
+     * @param [in] ts The absolute event timestamp.
+     * @param [in] event The event implementation.
+     * @returns The uid of the event.
+     */
+    uint64_t Insert(Partition& partition, uint32_t context, uint64_t ts, EventImpl* event);
+
+    /**
+     * Process the next event of a partition.
+     *
+     * @param [in] partition The partition.
+     */
+    void ProcessOneEvent(Partition& partition);
+
+    /**
+     * Process the events of a partition earlier than the window end.
+     *
+     * @param [in] partition The partition.
+     */
+    void ProcessWindow(Partition& partition);
+
+    /**
+     * Between two windows, with all the threads stopped: deliver the
+     * pending events, run the global events due, and set up the next
+     * window, or end the run.
+     */
+    void Synchronize();
+
+    /**
+     * Get the timestamp of the next event of a partition.
+     *
+     * @param [in] partition The partition.
+     * @returns The timestamp, or the largest one if there is none.
+     */
+    static uint64_t NextTs(const Partition& partition);
+
+    /** The partition of the calling thread, while it runs a window. */
+    static thread_local Partition* t_partition;
+
+    /** Number of threads, and of node partitions. */
+    uint32_t m_threadCount;
+    /** The smallest delay of an event scheduled for another partition. */
+    Time m_lookahead;
+    /** The factory of the partition schedulers. */
+    ObjectFactory m_schedulerFactory;
+    /** The node partitions, followed by the global partition. */
+    std::vector<Partition> m_partitions;
+    /** The global partition, last of m_partitions. */
+    Partition* m_global;
+
+    /** End (excluded) of the current window. */
+    uint64_t m_windowEnd;
+    /** Flag calling for the end of the simulation. */
+    std::atomic<bool> m_stop;
+    /** Flag set by Synchronize() at the end of the run. */
+    bool m_done;
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
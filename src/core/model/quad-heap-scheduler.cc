@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "quad-heap-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+
+#include <algorithm>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * Implementation of ns3::QuadHeapScheduler class.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("QuadHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(QuadHeapScheduler);
+
+namespace
+{
+
+/** Number of children of a heap node. */
+constexpr std::size_t ARITY = 4;
+
+} // unnamed namespace
+
+TypeId
+QuadHeapScheduler::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::QuadHeapScheduler")
+                            .SetParent<Scheduler>()
+                            .SetGroupName("Core")
+                            .AddConstructor<QuadHeapScheduler>();
+    return tid;
+}
+
+QuadHeapScheduler::QuadHeapScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+QuadHeapScheduler::~QuadHeapScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+bool
+QuadHeapScheduler::IsLess(const Key& a, const Key& b)
+{
+    return Scheduler::EventKey{a.ts, a.uid, 0} < Scheduler::EventKey{b.ts, b.uid, 0};
+}
+
+void
+QuadHeapScheduler::SiftUp(std::size_t index)
+{
+    Key key = m_keys[index];
+    Payload payload = m_payloads[index];
+    while (index > 0)
+    {
+        std::size_t parent = (index - 1) / ARITY;
+        if (!IsLess(key, m_keys[parent]))
+        {
+            break;
+        }
+        m_keys[index] = m_keys[parent];
+        m_payloads[index] = m_payloads[parent];
+        index = parent;
+    }
+    m_keys[index] = key;
+    m_payloads[index] = payload;
+}
+
+void
+QuadHeapScheduler::SiftDown(std::size_t index)
+{
+    std::size_t size = m_keys.size();
+    Key key = m_keys[index];
+    Payload payload = m_payloads[index];
+    while (true)
+    {
+        std::size_t first = index * ARITY + 1;
+        if (first >= size)
+        {
+            break;
+        }
+        std::size_t last = std::min(first + ARITY, size);
+        std::size_t smallest = first;
+        for (std::size_t child = first + 1; child < last; ++child)
+        {
+            if (IsLess(m_keys[child], m_keys[smallest]))
+            {
+                smallest = child;
+            }
+        }
+        if (!IsLess(m_keys[smallest], key))
+        {
+            break;
+        }
+        m_keys[index] = m_keys[smallest];
+        m_payloads[index] = m_payloads[smallest];
+        index = smallest;
+    }
+    m_keys[index] = key;
+    m_payloads[index] = payload;
+}
+
+void
+QuadHeapScheduler::RemoveAt(std::size_t index)
+{
+    std::size_t last = m_keys.size() - 1;
+    if (index != last)
+    {
+        bool up = IsLess(m_keys[last], m_keys[index]);
+        m_keys[index] = m_keys[last];
+        m_payloads[index] = m_payloads[last];
+        m_keys.pop_back();
+        m_payloads.pop_back();
+        if (up)
+        {
+            SiftUp(index);
+        }
+        else
+        {
+            SiftDown(index);
+        }
+        return;
+    }
+    m_keys.pop_back();
+    m_payloads.pop_back();
+}
+
+void
+QuadHeapScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    m_keys.push_back({ev.key.m_ts, ev.key.m_uid});
+    m_payloads.push_back({ev.impl, ev.key.m_context});
+    SiftUp(m_keys.size() - 1);
+}
+
+bool
+QuadHeapScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_keys.empty();
+}
+
+Scheduler::Event
+QuadHeapScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    return {m_payloads[0].impl, {m_keys[0].ts, m_keys[0].uid, m_payloads[0].context}};
+}
+
+Scheduler::Event
+QuadHeapScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    Event next = PeekNext();
+    RemoveAt(0);
+    return next;
+}
+
+void
+QuadHeapScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    for (std::size_t i = 0; i < m_keys.size(); i++)
+    {
+        if (m_keys[i].uid == ev.key.m_uid)
+        {
+            NS_ASSERT(m_payloads[i].impl == ev.impl);
+            RemoveAt(i);
+            return;
+        }
+    }
+    NS_ASSERT(false);
+}
+
+} // namespace ns3
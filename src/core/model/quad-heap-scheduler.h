@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef QUAD_HEAP_SCHEDULER_H
+#define QUAD_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::QuadHeapScheduler declaration.
+ */
+
+namespace ns3
+{
+
+class EventImpl;
+
+/**
+ * @ingroup scheduler
+ * @brief a cache-friendly 4-ary heap event scheduler
+ *
+ * Like HeapScheduler, events are kept in contiguous memory, but the heap
+ * has four children per node instead of two, which halves its depth, and
+ * the sort keys (time stamp and uid) are stored apart from the event
+ * pointers and contexts. The heap operations only compare keys: the four
+ * 16-byte keys of a set of siblings share a single cache line, and the
+ * rest of the events is only moved along with them.
+ *
+ * Entries are moved into the hole left by an insertion or a removal
+ * rather than swapped, so that each level costs a single copy.
+ *
+ * @par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | Logarithmic     | Sift up, base 4
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Heap kept sorted
+ * Remove()     | Linear          | Search, sift
+ * RemoveNext() | Logarithmic     | Sift down, base 4
+ *
+ * @par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 6 x `sizeof (*)`<br/>(48 bytes)  | Two `std::vector`
+ * Per Event | 0                                | Keys and events stored in `std::vector` directly
+ */
+class QuadHeapScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    QuadHeapScheduler();
+    /** Destructor. */
+    ~QuadHeapScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** The part of an EventKey the heap is sorted on. */
+    struct Key
+    {
+        uint64_t ts;  /**< Event time stamp. */
+        uint64_t uid; /**< Event unique id. */
+    };
+
+    /** The rest of an event. */
+    struct Payload
+    {
+        EventImpl* impl;  /**< Event implementation. */
+        uint32_t context; /**< Event context. */
+    };
+
+    /**
+     * Compare (less than) two keys, as EventKey does.
+     *
+     * @param [in] a The first key.
+     * @param [in] b The second key.
+     * @returns \c true if \c a < \c b
+     */
+    static bool IsLess(const Key& a, const Key& b);
+
+    /**
+     * Move the entry at an index up until its parent is smaller.
+     *
+     * @param [in] index The index of the entry.
+     */
+    void SiftUp(std::size_t index);
+    /**
+     * Move the entry at an index down until its children are larger.
+     *
+     * @param [in] index The index of the entry.
+     */
+    void SiftDown(std::size_t index);
+    /**
+     * Replace the entry at an index by the last one, and restore the heap.
+     *
+     * @param [in] index The index of the entry to remove.
+     */
+    void RemoveAt(std::size_t index);
+
+    /** The event keys, managed as a 4-ary heap rooted at index 0. */
+    std::vector<Key> m_keys;
+    /** The event of each key, at the same index. */
+    std::vector<Payload> m_payloads;
+};
+
+} // namespace ns3
+
+#endif /* QUAD_HEAP_SCHEDULER_H */
@@ -27,6 +27,7 @@
 #include <algorithm> // upper_bound
 #include <cmath>
 #include <iostream>
+#include <map>
 #include <numbers>
 
 /**
@@ -42,6 +43,27 @@ NS_LOG_COMPONENT_DEFINE("RandomVariableStream");
 
 NS_OBJECT_ENSURE_REGISTERED(RandomVariableStream);
 
+namespace
+{
+
+/**
+ * @ingroup randomvariable
+ * @brief Get the live streams, with the RngStream index each one uses.
+ *
+ * The map is never deleted, so that streams held by static objects
+ * can still unregister themselves at program exit.
+ *
+ * @return The stream registry.
+ */
+std::map<RandomVariableStream*, uint64_t>&
+GetStreamRegistry()
+{
+    static auto* streams = new std::map<RandomVariableStream*, uint64_t>;
+    return *streams;
+}
+
+} // unnamed namespace
+
 TypeId
 RandomVariableStream::GetTypeId()
 {
@@ -75,6 +97,7 @@ RandomVariableStream::RandomVariableStream()
 
 RandomVariableStream::~RandomVariableStream()
 {
+    GetStreamRegistry().erase(this);
     delete m_rng;
 }
 
@@ -115,6 +138,7 @@ RandomVariableStream::SetStream(int64_t stream)
         NS_ASSERT(nextStream <= ((1ULL) << 63));
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " automatic stream: " << nextStream);
         m_rng = new RngStream(RngSeedManager::GetSeed(), nextStream, RngSeedManager::GetRun());
+        GetStreamRegistry()[this] = nextStream;
     }
     else
     {
@@ -124,6 +148,7 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t target = base + stream;
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " configured stream: " << stream);
         m_rng = new RngStream(RngSeedManager::GetSeed(), target, RngSeedManager::GetRun());
+        GetStreamRegistry()[this] = target;
     }
     m_stream = stream;
 }
@@ -134,6 +159,18 @@ RandomVariableStream::GetStream() const
     return m_stream;
 }
 
+void
+RandomVariableStream::ResetAllStreams()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    for (const auto& [stream, index] : GetStreamRegistry())
+    {
+        delete stream->m_rng;
+        stream->m_rng =
+            new RngStream(RngSeedManager::GetSeed(), index, RngSeedManager::GetRun());
+    }
+}
+
 RngStream*
 RandomVariableStream::Peek() const
 {
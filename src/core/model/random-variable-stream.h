@@ -133,6 +133,17 @@ class RandomVariableStream : public Object
      */
     bool IsAntithetic() const;
 
+    /**
+     * @brief Restart every existing stream for the current seed and run.
+     *
+     * Each stream keeps its stream number but starts over at the beginning
+     * of the substream selected by the current RngSeedManager run number,
+     * exactly as if it had been created now. This lets a simulation that was
+     * set up (and possibly warmed up) under one run number continue with
+     * random numbers independent of the ones the other runs use.
+     */
+    static void ResetAllStreams();
+
     /**
      * @brief Get the next random value drawn from the distribution.
      * @return A random value.
@@ -123,6 +123,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 24 bytes </td>
  *      <td class="markdownTableBodyLeft"> 0 </td>
  * </tr>
+ * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> QuadHeapScheduler </td>
+ *      <td class="markdownTableBodyLeft"> 4-ary heap on two `std::vector` </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic  </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic </td>
+ *      <td class="markdownTableBodyLeft"> 48 bytes </td>
+ *      <td class="markdownTableBodyLeft"> 0 </td>
+ * </tr>
  * </table>
  *
  * It is possible to change the Scheduler choice during a simulation,
@@ -158,7 +166,7 @@ class Scheduler : public Object
     struct EventKey
     {
         uint64_t m_ts;      /**< Event time stamp. */
-        uint32_t m_uid;     /**< Event unique id. */
+        uint64_t m_uid;     /**< Event unique id. */
         uint32_t m_context; /**< Event context. */
     };
 
@@ -261,7 +269,13 @@ operator!=(const Scheduler::EventKey& a, const Scheduler::EventKey& b)
 inline bool
 operator<(const Scheduler::EventKey& a, const Scheduler::EventKey& b)
 {
+#ifdef __SIZEOF_INT128__
+    // (m_ts, m_uid) as a single 128-bit number: one compare, no branch
+    using Wide = __uint128_t;
+    return ((Wide(a.m_ts) << 64) | a.m_uid) < ((Wide(b.m_ts) << 64) | b.m_uid);
+#else
     return (a.m_ts < b.m_ts || (a.m_ts == b.m_ts && a.m_uid < b.m_uid));
+#endif
 }
 
 /**
@@ -274,7 +288,7 @@ operator<(const Scheduler::EventKey& a, const Scheduler::EventKey& b)
 inline bool
 operator>(const Scheduler::EventKey& a, const Scheduler::EventKey& b)
 {
-    return (a.m_ts > b.m_ts || (a.m_ts == b.m_ts && a.m_uid > b.m_uid));
+    return b < a;
 }
 
 /**
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "simulator-checkpoint.h"
+
+#include "abort.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::SimulatorCheckpoint implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SimulatorCheckpoint");
+
+uint32_t SimulatorCheckpoint::m_failed = 0;
+
+uint32_t
+SimulatorCheckpoint::Branch(uint32_t nBranches, uint32_t maxParallel)
+{
+    NS_LOG_FUNCTION(nBranches << maxParallel);
+
+    if (maxParallel == 0)
+    {
+        maxParallel = nBranches;
+    }
+    m_failed = 0;
+
+    uint32_t running = 0;
+    auto reap = [&running]() {
+        int status;
+        pid_t pid;
+        do
+        {
+            pid = waitpid(-1, &status, 0);
+        } while (pid == -1 && errno == EINTR);
+        NS_ABORT_MSG_IF(pid == -1, "waitpid() failed: " << std::strerror(errno));
+        --running;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            NS_LOG_WARN("Branch process " << pid << " failed");
+            ++m_failed;
+        }
+    };
+
+    for (uint32_t branch = 0; branch < nBranches; ++branch)
+    {
+        while (running >= maxParallel)
+        {
+            reap();
+        }
+
+        // Do not let every branch print what was buffered before the snapshot
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+
+        pid_t pid = fork();
+        NS_ABORT_MSG_IF(pid == -1, "fork() failed: " << std::strerror(errno));
+        if (pid == 0)
+        {
+            NS_LOG_INFO("Branch " << branch << " starts at " << Simulator::Now().As(Time::S));
+            return branch;
+        }
+        NS_LOG_INFO("Started branch " << branch << " as process " << pid);
+        ++running;
+    }
+    while (running > 0)
+    {
+        reap();
+    }
+    return PARENT;
+}
+
+uint32_t
+SimulatorCheckpoint::GetFailedBranches()
+{
+    return m_failed;
+}
+
+} // namespace ns3
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef SIMULATOR_CHECKPOINT_H
+#define SIMULATOR_CHECKPOINT_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::SimulatorCheckpoint declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ * @brief Snapshot a simulation after setup and run several branches from it.
+ *
+ * Building a scenario and warming it up can cost more than the part of the
+ * run that is actually measured, and it is the same for every sweep point
+ * that only changes the seed or the traffic. Branch() takes a copy-on-write
+ * snapshot of the whole process with fork(2): the object graph, attribute
+ * values, pending events and random stream positions are all preserved, and
+ * each branch continues the simulation from there in its own process.
+ *
+ * @code
+ *   // build the scenario, then warm it up
+ *   Simulator::Stop(warmUp);
+ *   Simulator::Run();
+ *
+ *   uint32_t branch = SimulatorCheckpoint::Branch(nBranches, maxParallel);
+ *   if (branch != SimulatorCheckpoint::PARENT)
+ *   {
+ *       RngSeedManager::SetRun(firstRun + branch);
+ *       RandomVariableStream::ResetAllStreams();
+ *       // apply the per-branch configuration, run and write the results
+ *       Simulator::Stop(duration);
+ *       Simulator::Run();
+ *   }
+ *   Simulator::Destroy();
+ * @endcode
+ *
+ * Only the sequential simulator implementations can be branched: threads do
+ * not survive fork(2). Files opened before the snapshot are shared by all
+ * the branches, so per-branch output should be opened after it.
+ */
+class SimulatorCheckpoint
+{
+  public:
+    /** Value returned by Branch() to the process that took the snapshot. */
+    static constexpr uint32_t PARENT = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Fork the current simulation state into independent branches.
+     *
+     * In the calling process this waits until every branch has exited and
+     * returns PARENT; in each branch it returns the branch index.
+     *
+     * @param [in] nBranches Number of branches.
+     * @param [in] maxParallel Maximum number of branches running at the
+     *             same time, 0 for no limit.
+     * @return The branch index in [0, nBranches), or PARENT.
+     */
+    static uint32_t Branch(uint32_t nBranches, uint32_t maxParallel = 1);
+
+    /**
+     * @brief Get the outcome of the last Branch() call.
+     * @return The number of branches that did not exit with status 0.
+     */
+    static uint32_t GetFailedBranches();
+
+  private:
+    /** Number of branches that failed in the last Branch() call. */
+    static uint32_t m_failed;
+};
+
+} // namespace ns3
+
+#endif /* SIMULATOR_CHECKPOINT_H */
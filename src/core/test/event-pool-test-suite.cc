@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/event-pool.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup events
+ * @ingroup event-pool-tests
+ * EventPool test suite.
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup event-pool-tests EventPool test suite
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup event-pool-tests
+ * Check that a chain of events reuses the same blocks, unless the pool is disabled.
+ */
+class EventPoolTestCase : public TestCase
+{
+    bool m_enabled;   //!< Whether the pool is enabled during the test.
+    uint32_t m_count; //!< Number of events executed.
+
+    /** Event rescheduling itself. */
+    void Chain();
+
+  public:
+    /**
+     * Constructor.
+     * @param enabled Whether the pool is enabled during the test.
+     */
+    EventPoolTestCase(bool enabled);
+    void DoRun() override;
+};
+
+EventPoolTestCase::EventPoolTestCase(bool enabled)
+    : TestCase(enabled ? "Check that freed events are reused"
+                       : "Check that a disabled pool allocates every event"),
+      m_enabled(enabled),
+      m_count(0)
+{
+}
+
+void
+EventPoolTestCase::Chain()
+{
+    if (++m_count < 1000)
+    {
+        Simulator::Schedule(MicroSeconds(1), &EventPoolTestCase::Chain, this);
+    }
+}
+
+void
+EventPoolTestCase::DoRun()
+{
+    bool enabled = EventPool::IsEnabled();
+    EventPool::SetEnabled(m_enabled);
+    EventPool::ResetStats();
+
+    Simulator::Schedule(MicroSeconds(1), &EventPoolTestCase::Chain, this);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    EventPool::Stats stats = EventPool::GetStats();
+    EventPool::SetEnabled(enabled);
+
+    NS_TEST_EXPECT_MSG_EQ(m_count, 1000, "Wrong number of events");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(stats.allocations, 1000, "Events were not counted");
+    if (m_enabled)
+    {
+        NS_TEST_EXPECT_MSG_LT(stats.heapAllocations, 10, "Freed events were not reused");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_EQ(stats.heapAllocations, stats.allocations, "Events were reused");
+    }
+}
+
+/**
+ * @ingroup event-pool-tests
+ * EventPool test suite.
+ */
+class EventPoolTestSuite : public TestSuite
+{
+  public:
+    EventPoolTestSuite();
+};
+
+EventPoolTestSuite::EventPoolTestSuite()
+    : TestSuite("event-pool")
+{
+    AddTestCase(new EventPoolTestCase(true));
+    AddTestCase(new EventPoolTestCase(false));
+}
+
+/**
+ * @ingroup event-pool-tests
+ * EventPoolTestSuite instance variable.
+ */
+static EventPoolTestSuite g_eventPoolTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
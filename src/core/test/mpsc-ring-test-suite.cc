@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/config.h"
+#include "ns3/log.h"
+#include "ns3/mpsc-ring.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * MpscRing and cross-thread event injection test suite.
+ */
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("MpscRingTestSuite");
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief Check the MpscRing bounds and the per-producer order under contention.
+ */
+class MpscRingTestCase : public TestCase
+{
+  public:
+    MpscRingTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MpscRingTestCase::MpscRingTestCase()
+    : TestCase("Check MpscRing with concurrent producers")
+{
+}
+
+void
+MpscRingTestCase::DoRun()
+{
+    // Bounds, from a single thread
+    MpscRing<int> small(8);
+    int item;
+    NS_TEST_EXPECT_MSG_EQ(small.IsEmpty(), true, "New ring not empty");
+    NS_TEST_EXPECT_MSG_EQ(small.Pop(item), false, "Popped from an empty ring");
+    for (int i = 0; i < 8; ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(small.Push(i), true, "Ring full too early");
+    }
+    NS_TEST_EXPECT_MSG_EQ(small.Push(8), false, "Pushed into a full ring");
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            NS_TEST_ASSERT_MSG_EQ(small.Pop(item), true, "Item lost");
+            NS_TEST_EXPECT_MSG_EQ(item, lap * 8 + i, "Items out of order");
+            NS_TEST_EXPECT_MSG_EQ(small.Push(lap * 8 + i + 8), true, "Freed slot not reused");
+        }
+    }
+
+    // Contention: a small ring, so that producers keep finding it full
+    const uint32_t producers = 4;
+    const uint32_t perProducer = 100000;
+    MpscRing<std::pair<uint32_t, uint32_t>> ring(64);
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&ring, p, perProducer]() {
+            for (uint32_t i = 0; i < perProducer; ++i)
+            {
+                while (!ring.Push({p, i}))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(producers, 0);
+    uint64_t popped = 0;
+    bool ordered = true;
+    std::pair<uint32_t, uint32_t> pair;
+    while (popped < uint64_t(producers) * perProducer)
+    {
+        if (!ring.Pop(pair))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && pair.first < producers && pair.second == next[pair.first];
+        ++next[pair.first];
+        ++popped;
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    NS_TEST_EXPECT_MSG_EQ(ordered, true, "Items of a producer popped out of order");
+    NS_TEST_EXPECT_MSG_EQ(ring.IsEmpty(), true, "Spurious items");
+}
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief Stress DefaultSimulatorImpl::ScheduleWithContext from many threads.
+ *
+ * Every thread schedules its events back to back, as fast as it can, while
+ * the simulation runs. All the events must run, those of a thread in the
+ * order it scheduled them, whether they went through the lock-free inbox or
+ * its overflow list. The injection rate is logged, as a benchmark.
+ */
+class SimulatorInboxStressTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param threads The number of injecting threads.
+     * @param perThread The number of events each thread schedules.
+     */
+    SimulatorInboxStressTestCase(uint32_t threads, uint32_t perThread);
+
+  private:
+    void DoRun() override;
+
+    /** Start the injecting threads, once the simulator runs. */
+    void Start();
+    /** Keep the simulation alive until all the events arrived. */
+    void Poll();
+    /**
+     * An injected event.
+     *
+     * @param thread The thread which scheduled it.
+     * @param index The index of the event in that thread.
+     */
+    void Receive(uint32_t thread, uint32_t index);
+
+    uint32_t m_threads;                 //!< Number of injecting threads.
+    uint32_t m_perThread;               //!< Events scheduled by each thread.
+    std::vector<std::thread> m_workers; //!< The injecting threads.
+    std::vector<uint32_t> m_next;       //!< Next expected index, per thread.
+    uint64_t m_received;                //!< Number of events run.
+    bool m_ordered;                     //!< Whether all threads kept their order.
+};
+
+SimulatorInboxStressTestCase::SimulatorInboxStressTestCase(uint32_t threads, uint32_t perThread)
+    : TestCase("Check cross-thread event injection, " + std::to_string(threads) + " threads x " +
+               std::to_string(perThread) + " events"),
+      m_threads(threads),
+      m_perThread(perThread),
+      m_received(0),
+      m_ordered(true)
+{
+}
+
+void
+SimulatorInboxStressTestCase::Start()
+{
+    for (uint32_t t = 0; t < m_threads; ++t)
+    {
+        m_workers.emplace_back([this, t]() {
+            for (uint32_t i = 0; i < m_perThread; ++i)
+            {
+                Simulator::ScheduleWithContext(t,
+                                               Time(0),
+                                               &SimulatorInboxStressTestCase::Receive,
+                                               this,
+                                               t,
+                                               i);
+            }
+        });
+    }
+    Poll();
+}
+
+void
+SimulatorInboxStressTestCase::Poll()
+{
+    if (m_received < uint64_t(m_threads) * m_perThread)
+    {
+        Simulator::Schedule(NanoSeconds(1), &SimulatorInboxStressTestCase::Poll, this);
+    }
+}
+
+void
+SimulatorInboxStressTestCase::Receive(uint32_t thread, uint32_t index)
+{
+    m_ordered = m_ordered && index == m_next[thread];
+    ++m_next[thread];
+    ++m_received;
+}
+
+void
+SimulatorInboxStressTestCase::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+    m_next.assign(m_threads, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::ScheduleNow(&SimulatorInboxStressTestCase::Start, this);
+    Simulator::Run();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+    double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Simulator::Destroy();
+
+    NS_LOG_INFO(m_received << " events injected by " << m_threads << " threads in " << elapsed
+                           << " s: " << m_received / elapsed << " events/s");
+    NS_TEST_EXPECT_MSG_EQ(m_received, uint64_t(m_threads) * m_perThread, "Events lost");
+    NS_TEST_EXPECT_MSG_EQ(m_ordered, true, "Events of a thread run out of order");
+}
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief MpscRing TestSuite
+ */
+class MpscRingTestSuite : public TestSuite
+{
+  public:
+    MpscRingTestSuite();
+};
+
+MpscRingTestSuite::MpscRingTestSuite()
+    : TestSuite("mpsc-ring", Type::UNIT)
+{
+    AddTestCase(new MpscRingTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new SimulatorInboxStressTestCase(1, 20000), TestCase::Duration::QUICK);
+    AddTestCase(new SimulatorInboxStressTestCase(8, 20000), TestCase::Duration::QUICK);
+    AddTestCase(new SimulatorInboxStressTestCase(16, 1000000), TestCase::Duration::EXTENSIVE);
+}
+
+static MpscRingTestSuite g_mpscRingTestSuite; //!< Static variable for test initialization
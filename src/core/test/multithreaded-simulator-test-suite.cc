@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/config.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * MultithreadedSimulatorImpl test suite.
+ */
+
+using namespace ns3;
+
+namespace
+{
+
+/** Number of nodes of the scenarios. */
+constexpr uint32_t NODES = 16;
+/** Lookahead of the scenarios, in ns. */
+constexpr int64_t LOOKAHEAD = 1000;
+
+/**
+ * Select a simulator implementation for the next run.
+ *
+ * @param [in] threads The number of threads of MultithreadedSimulatorImpl,
+ * or 0 for DefaultSimulatorImpl.
+ */
+void
+SelectSimulator(uint32_t threads)
+{
+    if (threads == 0)
+    {
+        Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+        return;
+    }
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::ThreadCount", UintegerValue(threads));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::Lookahead",
+                       TimeValue(NanoSeconds(LOOKAHEAD)));
+}
+
+} // unnamed namespace
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief Check that nodes exchanging events across partitions see the same
+ * events, at the same times, as with DefaultSimulatorImpl.
+ *
+ * Every node runs a local timer, faster than the lookahead, and relays a
+ * message around the ring of nodes, one lookahead or more per hop. Each
+ * node also removes a pending event of its own, and a global event injects
+ * one more message. The events of every node are logged by that node only.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param threads The number of threads.
+     */
+    MultithreadedSimulatorTestCase(uint32_t threads);
+
+  private:
+    void DoRun() override;
+
+    /** An event of a node: time stamp, kind, and argument. */
+    using Record = std::tuple<int64_t, char, uint32_t>;
+
+    /**
+     * Run the scenario.
+     *
+     * @param threads The number of threads, 0 for DefaultSimulatorImpl.
+     */
+    void RunScenario(uint32_t threads);
+
+    /**
+     * Start a node.
+     *
+     * @param node The node.
+     */
+    void Start(uint32_t node);
+    /**
+     * A timer event.
+     *
+     * @param node The node.
+     * @param count The number of timer events so far.
+     */
+    void Timer(uint32_t node, uint32_t count);
+    /**
+     * A message relayed around the ring.
+     *
+     * @param node The node.
+     * @param hops The number of hops so far.
+     */
+    void Message(uint32_t node, uint32_t hops);
+    /**
+     * An event removed before it runs.
+     *
+     * @param node The node.
+     */
+    void Removed(uint32_t node);
+    /** The global event. */
+    void Global();
+    /**
+     * Log an event of a node, checking its context and time.
+     *
+     * @param node The node.
+     * @param kind The kind of event.
+     * @param value The argument of the event.
+     */
+    void Log(uint32_t node, char kind, uint32_t value);
+
+    uint32_t m_threads;                     //!< Number of threads.
+    std::vector<std::vector<Record>> m_log; //!< The events, per node.
+    std::vector<uint32_t> m_errors;         //!< Inconsistencies seen, per node.
+    std::vector<EventId> m_removed;         //!< The event to remove, per node.
+    uint32_t m_globalContext;               //!< Context of the global event.
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase(uint32_t threads)
+    : TestCase("Check MultithreadedSimulatorImpl against DefaultSimulatorImpl, " +
+               std::to_string(threads) + " threads"),
+      m_threads(threads),
+      m_globalContext(0)
+{
+}
+
+void
+MultithreadedSimulatorTestCase::Log(uint32_t node, char kind, uint32_t value)
+{
+    int64_t now = Simulator::Now().GetTimeStep();
+    if (Simulator::GetContext() != node ||
+        (!m_log[node].empty() && std::get<0>(m_log[node].back()) > now))
+    {
+        m_errors[node]++;
+    }
+    m_log[node].emplace_back(now, kind, value);
+}
+
+void
+MultithreadedSimulatorTestCase::Start(uint32_t node)
+{
+    Log(node, 'S', 0);
+    Simulator::Schedule(NanoSeconds(700 * (node + 1)),
+                        &MultithreadedSimulatorTestCase::Timer,
+                        this,
+                        node,
+                        1);
+    m_removed[node] =
+        Simulator::Schedule(MilliSeconds(5), &MultithreadedSimulatorTestCase::Removed, this, node);
+    Simulator::ScheduleWithContext((node + 1) % NODES,
+                                   NanoSeconds(LOOKAHEAD + 37 * node),
+                                   &MultithreadedSimulatorTestCase::Message,
+                                   this,
+                                   (node + 1) % NODES,
+                                   1);
+}
+
+void
+MultithreadedSimulatorTestCase::Timer(uint32_t node, uint32_t count)
+{
+    Log(node, 'T', count);
+    if (count == 3)
+    {
+        if (Simulator::IsExpired(m_removed[node]))
+        {
+            m_errors[node]++;
+        }
+        Simulator::Remove(m_removed[node]);
+        if (!Simulator::IsExpired(m_removed[node]))
+        {
+            m_errors[node]++;
+        }
+    }
+    if (count < 200)
+    {
+        Simulator::Schedule(NanoSeconds(700 * (node + 1)),
+                            &MultithreadedSimulatorTestCase::Timer,
+                            this,
+                            node,
+                            count + 1);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Message(uint32_t node, uint32_t hops)
+{
+    Log(node, 'M', hops);
+    if (hops < 100)
+    {
+        uint32_t next = (node + 1) % NODES;
+        Simulator::ScheduleWithContext(next,
+                                       NanoSeconds(LOOKAHEAD + (37 * node + 11 * hops) % 500),
+                                       &MultithreadedSimulatorTestCase::Message,
+                                       this,
+                                       next,
+                                       hops + 1);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Removed(uint32_t node)
+{
+    Log(node, 'R', 0);
+}
+
+void
+MultithreadedSimulatorTestCase::Global()
+{
+    m_globalContext = Simulator::GetContext();
+    Simulator::ScheduleWithContext(5,
+                                   Time(0),
+                                   &MultithreadedSimulatorTestCase::Message,
+                                   this,
+                                   5,
+                                   1000);
+}
+
+void
+MultithreadedSimulatorTestCase::RunScenario(uint32_t threads)
+{
+    SelectSimulator(threads);
+    m_log.assign(NODES, {});
+    m_errors.assign(NODES, 0);
+    m_removed.assign(NODES, EventId());
+    m_globalContext = 0;
+
+    for (uint32_t node = 0; node < NODES; ++node)
+    {
+        Simulator::ScheduleWithContext(node,
+                                       Time(0),
+                                       &MultithreadedSimulatorTestCase::Start,
+                                       this,
+                                       node);
+    }
+    Simulator::Schedule(MicroSeconds(20), &MultithreadedSimulatorTestCase::Global, this);
+    Simulator::Run();
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun()
+{
+    RunScenario(0);
+    uint64_t expectedCount = Simulator::GetEventCount();
+    Time expectedEnd = Simulator::Now();
+    Simulator::Destroy();
+    std::vector<std::vector<Record>> expected = m_log;
+
+    RunScenario(m_threads);
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount(), expectedCount, "Different event count");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), expectedEnd, "Different end time");
+    Simulator::Destroy();
+    SelectSimulator(0);
+
+    NS_TEST_EXPECT_MSG_EQ(m_globalContext, Simulator::NO_CONTEXT, "Global event with a context");
+    for (uint32_t node = 0; node < NODES; ++node)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_errors[node], 0U, "Wrong context, time or expiry at node " << node);
+        // Events of a node at the same time may run in a different order
+        std::sort(expected[node].begin(), expected[node].end());
+        std::sort(m_log[node].begin(), m_log[node].end());
+        NS_TEST_EXPECT_MSG_EQ((m_log[node] == expected[node]),
+                              true,
+                              "Different events at node " << node);
+    }
+}
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief Check Simulator::Stop, from main and from an event of a node.
+ */
+class MultithreadedSimulatorStopTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorStopTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * A timer event.
+     *
+     * @param node The node.
+     */
+    void Timer(uint32_t node);
+
+    std::vector<uint32_t> m_count; //!< Number of timer events, per node.
+    std::vector<Time> m_last;      //!< Time of the last timer event, per node.
+    uint32_t m_stopAt;             //!< Count at which node 2 stops the simulation.
+};
+
+MultithreadedSimulatorStopTestCase::MultithreadedSimulatorStopTestCase()
+    : TestCase("Check MultithreadedSimulatorImpl stop"),
+      m_stopAt(0)
+{
+}
+
+void
+MultithreadedSimulatorStopTestCase::Timer(uint32_t node)
+{
+    m_count[node]++;
+    m_last[node] = Simulator::Now();
+    if (node == 2 && m_count[node] == m_stopAt)
+    {
+        Simulator::Stop();
+        return;
+    }
+    Simulator::Schedule(NanoSeconds(300), &MultithreadedSimulatorStopTestCase::Timer, this, node);
+}
+
+void
+MultithreadedSimulatorStopTestCase::DoRun()
+{
+    const uint32_t nodes = 4;
+    for (uint32_t stopAt : {0, 5})
+    {
+        SelectSimulator(2);
+        m_count.assign(nodes, 0);
+        m_last.assign(nodes, Time(0));
+        m_stopAt = stopAt;
+        for (uint32_t node = 0; node < nodes; ++node)
+        {
+            Simulator::ScheduleWithContext(node,
+                                           NanoSeconds(300),
+                                           &MultithreadedSimulatorStopTestCase::Timer,
+                                           this,
+                                           node);
+        }
+        Simulator::Stop(MicroSeconds(10));
+        Simulator::Run();
+
+        if (stopAt == 0)
+        {
+            NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), MicroSeconds(10), "Wrong stop time");
+            for (uint32_t node = 0; node < nodes; ++node)
+            {
+                NS_TEST_EXPECT_MSG_EQ(m_count[node], 33U, "Wrong event count at node " << node);
+                NS_TEST_EXPECT_MSG_LT(m_last[node], MicroSeconds(10), "Event after the stop");
+            }
+        }
+        else
+        {
+            NS_TEST_EXPECT_MSG_EQ(m_count[2], stopAt, "Node 2 went on after its stop");
+            for (uint32_t node = 0; node < nodes; ++node)
+            {
+                NS_TEST_EXPECT_MSG_LT(m_last[node],
+                                      NanoSeconds(300 * stopAt + LOOKAHEAD),
+                                      "Window not ended by the stop at node " << node);
+            }
+        }
+        Simulator::Destroy();
+    }
+    SelectSimulator(0);
+}
+
+/**
+ * @ingroup core-tests
+ *
+ * @brief MultithreadedSimulatorImpl TestSuite
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite();
+};
+
+MultithreadedSimulatorTestSuite::MultithreadedSimulatorTestSuite()
+    : TestSuite("multithreaded-simulator", Type::UNIT)
+{
+    for (uint32_t threads : {1, 2, 4})
+    {
+        AddTestCase(new MultithreadedSimulatorTestCase(threads), TestCase::Duration::QUICK);
+    }
+    AddTestCase(new MultithreadedSimulatorStopTestCase, TestCase::Duration::QUICK);
+}
+
+static MultithreadedSimulatorTestSuite
+    g_multithreadedSimulatorTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator-checkpoint.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <unistd.h>
+
+using namespace ns3;
+
+/**
+ * @file
+ * @ingroup simulator-tests
+ * SimulatorCheckpoint test suite
+ */
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that ResetAllStreams() restarts existing streams for the current run.
+ */
+class ResetAllStreamsTestCase : public TestCase
+{
+  public:
+    ResetAllStreamsTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+ResetAllStreamsTestCase::ResetAllStreamsTestCase()
+    : TestCase("Check that existing streams can be restarted for another run")
+{
+}
+
+void
+ResetAllStreamsTestCase::DoRun()
+{
+    uint64_t run = RngSeedManager::GetRun();
+
+    RngSeedManager::SetRun(1);
+    Ptr<UniformRandomVariable> x = CreateObject<UniformRandomVariable>();
+    x->SetStream(42);
+    double first = x->GetValue();
+    x->GetValue();
+
+    RngSeedManager::SetRun(2);
+    RandomVariableStream::ResetAllStreams();
+    double branched = x->GetValue();
+
+    Ptr<UniformRandomVariable> y = CreateObject<UniformRandomVariable>();
+    y->SetStream(42);
+    NS_TEST_EXPECT_MSG_EQ(branched, y->GetValue(), "Stream was not restarted for run 2");
+    NS_TEST_EXPECT_MSG_NE(branched, first, "Run 2 repeats the values of run 1");
+
+    RngSeedManager::SetRun(1);
+    RandomVariableStream::ResetAllStreams();
+    NS_TEST_EXPECT_MSG_EQ(x->GetValue(), first, "Stream was not restarted for run 1");
+
+    RngSeedManager::SetRun(run);
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that every branch continues the simulation from the snapshot.
+ */
+class SimulatorCheckpointBranchTestCase : public TestCase
+{
+  public:
+    SimulatorCheckpointBranchTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Test event. */
+    void Count();
+
+    uint32_t m_count; //!< Number of events executed
+};
+
+SimulatorCheckpointBranchTestCase::SimulatorCheckpointBranchTestCase()
+    : TestCase("Check that branches resume the pending events of the snapshot")
+{
+}
+
+void
+SimulatorCheckpointBranchTestCase::Count()
+{
+    ++m_count;
+}
+
+void
+SimulatorCheckpointBranchTestCase::DoRun()
+{
+    m_count = 0;
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        Simulator::Schedule(Seconds(i), &SimulatorCheckpointBranchTestCase::Count, this);
+    }
+    Simulator::Stop(Seconds(4.5));
+    Simulator::Run();
+
+    uint32_t branch = SimulatorCheckpoint::Branch(3, 2);
+    if (branch != SimulatorCheckpoint::PARENT)
+    {
+        // Report through the exit status: the test framework lives in the parent
+        bool ok = m_count == 4 && Simulator::Now() == Seconds(4.5);
+        Simulator::Stop(Seconds(branch));
+        Simulator::Run();
+        ok = ok && m_count == 4 + branch;
+        _exit(ok ? 0 : 1);
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(SimulatorCheckpoint::GetFailedBranches(), 0, "A branch failed");
+    NS_TEST_EXPECT_MSG_EQ(m_count, 4, "Branches changed the state of the parent");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief SimulatorCheckpoint test suite.
+ */
+class SimulatorCheckpointTestSuite : public TestSuite
+{
+  public:
+    SimulatorCheckpointTestSuite();
+};
+
+SimulatorCheckpointTestSuite::SimulatorCheckpointTestSuite()
+    : TestSuite("simulator-checkpoint", Type::UNIT)
+{
+    AddTestCase(new ResetAllStreamsTestCase, Duration::QUICK);
+    AddTestCase(new SimulatorCheckpointBranchTestCase, Duration::QUICK);
+}
+
+static SimulatorCheckpointTestSuite
+    g_simulatorCheckpointTestSuite; //!< Static variable for test initialization
@@ -10,6 +10,7 @@
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/quad-heap-scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
@@ -651,6 +652,64 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that event uids past 32 bits keep their order and identity.
+ *
+ * Long runs can schedule more than 2^32 events: the uids around that
+ * boundary must neither wrap nor collide, in the schedulers and in EventId.
+ */
+class SchedulerUidWrapTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param schedulerFactory Scheduler factory.
+     */
+    SchedulerUidWrapTestCase(ObjectFactory schedulerFactory);
+    void DoRun() override;
+
+  private:
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerUidWrapTestCase::SchedulerUidWrapTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check event uid wrap-around with " + schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerUidWrapTestCase::DoRun()
+{
+    const uint64_t wrap = uint64_t(1) << 32;
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+
+    // Same time stamp, uids inserted out of order on both sides of 2^32
+    uint64_t uids[] = {wrap + 1, wrap - 1, EventId::UID::VALID, wrap + 2, wrap};
+    for (auto uid : uids)
+    {
+        scheduler->Insert({nullptr, {1000, uid, 0}});
+    }
+    // Truncated to 32 bits, this uid would be taken for wrap + 1
+    scheduler->Insert({nullptr, {1000, 1, 0}});
+    scheduler->Remove({nullptr, {1000, 1, 0}});
+
+    uint64_t expected[] = {EventId::UID::VALID, wrap - 1, wrap, wrap + 1, wrap + 2};
+    for (auto uid : expected)
+    {
+        NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), false, "Event " << uid << " lost");
+        NS_TEST_EXPECT_MSG_EQ(scheduler->RemoveNext().key.m_uid, uid, "Wrong event order");
+    }
+    NS_TEST_EXPECT_MSG_EQ(scheduler->IsEmpty(), true, "Spurious event");
+
+    EventId low(nullptr, 1000, 0, 1);
+    EventId high(nullptr, 1000, 0, wrap + 1);
+    NS_TEST_EXPECT_MSG_EQ(high.GetUid(), wrap + 1, "EventId uid truncated");
+    NS_TEST_EXPECT_MSG_EQ((low == high), false, "EventId uids collide");
+}
+
 /**
  * @ingroup simulator-tests
  *
@@ -674,6 +733,19 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.SetTypeId(QuadHeapScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+
+        for (auto tid : {ListScheduler::GetTypeId(),
+                         MapScheduler::GetTypeId(),
+                         HeapScheduler::GetTypeId(),
+                         CalendarScheduler::GetTypeId(),
+                         PriorityQueueScheduler::GetTypeId(),
+                         QuadHeapScheduler::GetTypeId()})
+        {
+            factory.SetTypeId(tid);
+            AddTestCase(new SchedulerUidWrapTestCase(factory), TestCase::Duration::QUICK);
+        }
     }
 };
 
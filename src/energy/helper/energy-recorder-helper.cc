@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "energy-recorder-helper.h"
+
+namespace ns3
+{
+
+EnergyRecorderHelper::EnergyRecorderHelper()
+{
+    m_recorderFactory.SetTypeId("ns3::energy::EnergyRecorder");
+}
+
+void
+EnergyRecorderHelper::SetRecorderAttribute(std::string n1, const AttributeValue& v1)
+{
+    m_recorderFactory.Set(n1, v1);
+}
+
+Ptr<energy::EnergyRecorder>
+EnergyRecorderHelper::GetRecorder()
+{
+    if (!m_recorder)
+    {
+        m_recorder = m_recorderFactory.Create<energy::EnergyRecorder>();
+    }
+    return m_recorder;
+}
+
+Ptr<energy::EnergyRecorder>
+EnergyRecorderHelper::Install(Ptr<energy::EnergySource> source)
+{
+    Ptr<energy::EnergyRecorder> recorder = GetRecorder();
+    recorder->AddSource(source);
+    return recorder;
+}
+
+Ptr<energy::EnergyRecorder>
+EnergyRecorderHelper::Install(const energy::EnergySourceContainer& sources)
+{
+    for (auto i = sources.Begin(); i != sources.End(); ++i)
+    {
+        Install(*i);
+    }
+    return GetRecorder();
+}
+
+} // namespace ns3
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ENERGY_RECORDER_HELPER_H
+#define ENERGY_RECORDER_HELPER_H
+
+#include "energy-source-container.h"
+
+#include "ns3/energy-recorder.h"
+#include "ns3/object-factory.h"
+
+#include <string>
+
+namespace ns3
+{
+
+class AttributeValue;
+
+/**
+ * @ingroup energy
+ * @brief Helper to record the remaining energy of a set of energy sources.
+ *
+ * All the sources installed through the same helper share a single
+ * energy::EnergyRecorder, and hence a single output file. The recorder
+ * outlives the helper: it is closed when the simulator is destroyed.
+ */
+class EnergyRecorderHelper
+{
+  public:
+    EnergyRecorderHelper();
+
+    /**
+     * @brief Set an attribute for the to-be-created EnergyRecorder object
+     * @param n1 attribute name
+     * @param v1 attribute value
+     */
+    void SetRecorderAttribute(std::string n1, const AttributeValue& v1);
+
+    /**
+     * @brief Record a single energy source
+     * @param source the energy source
+     * @returns a pointer to the EnergyRecorder object
+     */
+    Ptr<energy::EnergyRecorder> Install(Ptr<energy::EnergySource> source);
+
+    /**
+     * @brief Record a set of energy sources
+     * @param sources the energy sources
+     * @returns a pointer to the EnergyRecorder object
+     */
+    Ptr<energy::EnergyRecorder> Install(const energy::EnergySourceContainer& sources);
+
+    /**
+     * @brief Retrieve the EnergyRecorder object created by the Install methods
+     * @returns a pointer to the EnergyRecorder object
+     */
+    Ptr<energy::EnergyRecorder> GetRecorder();
+
+  private:
+    ObjectFactory m_recorderFactory;        //!< Object factory
+    Ptr<energy::EnergyRecorder> m_recorder; //!< the EnergyRecorder object
+};
+
+} // namespace ns3
+
+#endif /* ENERGY_RECORDER_HELPER_H */
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "energy-recorder.h"
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+
+namespace ns3
+{
+namespace energy
+{
+
+NS_LOG_COMPONENT_DEFINE("EnergyRecorder");
+NS_OBJECT_ENSURE_REGISTERED(EnergyRecorder);
+
+/// Magic string at the beginning of a recorder output file
+static const char ENERGY_RECORDER_MAGIC[8] = {'N', 'S', '3', 'E', 'N', 'R', 'G', '1'};
+
+TypeId
+EnergyRecorder::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::energy::EnergyRecorder")
+            .SetParent<Object>()
+            .SetGroupName("Energy")
+            .AddConstructor<EnergyRecorder>()
+            .AddAttribute("FileName",
+                          "Name of the binary file the samples are written to. While it is "
+                          "empty, the samples are kept in memory.",
+                          StringValue("energy.bin"),
+                          MakeStringAccessor(&EnergyRecorder::m_fileName),
+                          MakeStringChecker())
+            .AddAttribute("Resolution",
+                          "Minimum time between two kept samples of the same source "
+                          "(zero disables the criterion).",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&EnergyRecorder::m_resolution),
+                          MakeTimeChecker())
+            .AddAttribute("Threshold",
+                          "Minimum change of remaining energy, in joules, between two kept "
+                          "samples of the same source (zero disables the criterion).",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&EnergyRecorder::m_threshold),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("BufferSize",
+                          "Number of samples buffered before they are written to the file.",
+                          UintegerValue(65536),
+                          MakeUintegerAccessor(&EnergyRecorder::m_bufferSize),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+EnergyRecorder::EnergyRecorder()
+    : m_buffered(0),
+      m_nSamples(0),
+      m_closed(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+EnergyRecorder::~EnergyRecorder()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+EnergyRecorder::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+    m_series.clear();
+    Object::DoDispose();
+}
+
+void
+EnergyRecorder::AddSource(Ptr<EnergySource> source)
+{
+    NS_LOG_FUNCTION(this << source);
+    NS_ASSERT(source);
+    NS_ABORT_MSG_IF(m_closed, "Cannot add a source to a closed recorder");
+    NS_ABORT_MSG_UNLESS(source->GetNode(), "Energy source is not installed on a node");
+
+    if (m_series.empty())
+    {
+        // Make sure the last samples reach the file even if Close() is never called
+        Simulator::ScheduleDestroy(&EnergyRecorder::Close, Ptr<EnergyRecorder>(this));
+    }
+
+    auto index = static_cast<uint32_t>(m_series.size());
+    bool connected = source->TraceConnectWithoutContext(
+        "RemainingEnergy",
+        MakeCallback(&EnergyRecorder::RemainingEnergyTrace, this).Bind(index));
+    NS_ABORT_MSG_UNLESS(connected,
+                        "Energy source " << source->GetInstanceTypeId().GetName()
+                                         << " has no RemainingEnergy trace source");
+
+    Series series;
+    series.nodeId = source->GetNode()->GetId();
+    series.pending = false;
+    series.pendingEnergy = 0;
+    series.lastEnergy = 0;
+    m_series.push_back(series);
+    Append(m_series.back(), Simulator::Now(), source->GetRemainingEnergy());
+}
+
+void
+EnergyRecorder::RemainingEnergyTrace(uint32_t index, double oldValue, double newValue)
+{
+    NS_LOG_FUNCTION(this << index << oldValue << newValue);
+
+    if (m_closed)
+    {
+        return;
+    }
+
+    Series& series = m_series[index];
+    Time now = Simulator::Now();
+    bool useResolution = m_resolution.IsStrictlyPositive();
+    bool useThreshold = m_threshold > 0;
+    bool keep = (!useResolution && !useThreshold) ||
+                (useResolution && now - series.lastTime >= m_resolution) ||
+                (useThreshold && std::abs(newValue - series.lastEnergy) >= m_threshold);
+
+    if (keep)
+    {
+        Append(series, now, newValue);
+    }
+    else
+    {
+        series.pending = true;
+        series.pendingTime = now;
+        series.pendingEnergy = newValue;
+    }
+}
+
+void
+EnergyRecorder::Append(Series& series, Time time, double energy)
+{
+    series.time.push_back(time.GetSeconds());
+    series.energy.push_back(energy);
+    series.lastTime = time;
+    series.lastEnergy = energy;
+    series.pending = false;
+    ++m_nSamples;
+
+    if (++m_buffered >= m_bufferSize)
+    {
+        Flush();
+    }
+}
+
+void
+EnergyRecorder::Flush()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_buffered == 0 || m_fileName.empty())
+    {
+        return;
+    }
+
+    if (!m_file.is_open())
+    {
+        m_file.open(m_fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+        NS_ABORT_MSG_UNLESS(m_file.is_open(), "Unable to open " << m_fileName);
+        m_file.write(ENERGY_RECORDER_MAGIC, sizeof(ENERGY_RECORDER_MAGIC));
+    }
+
+    for (auto& series : m_series)
+    {
+        auto n = static_cast<uint32_t>(series.time.size());
+        if (n == 0)
+        {
+            continue;
+        }
+        m_file.write(reinterpret_cast<const char*>(&series.nodeId), sizeof(series.nodeId));
+        m_file.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        m_file.write(reinterpret_cast<const char*>(series.time.data()), n * sizeof(double));
+        m_file.write(reinterpret_cast<const char*>(series.energy.data()), n * sizeof(double));
+        series.time.clear();
+        series.energy.clear();
+    }
+    m_buffered = 0;
+}
+
+void
+EnergyRecorder::Close()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_closed)
+    {
+        return;
+    }
+
+    for (auto& series : m_series)
+    {
+        if (series.pending)
+        {
+            Append(series, series.pendingTime, series.pendingEnergy);
+        }
+    }
+    if (m_fileName.empty())
+    {
+        NS_LOG_WARN("No file name set, dropping " << m_buffered << " samples");
+    }
+    Flush();
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+    m_closed = true;
+}
+
+uint64_t
+EnergyRecorder::GetNSamples() const
+{
+    return m_nSamples;
+}
+
+} // namespace energy
+} // namespace ns3
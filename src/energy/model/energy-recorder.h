@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ENERGY_RECORDER_H
+#define ENERGY_RECORDER_H
+
+#include "energy-source.h"
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+namespace energy
+{
+
+/**
+ * @ingroup energy
+ *
+ * @brief Records the remaining energy of a set of energy sources over time.
+ *
+ * The recorder listens to the "RemainingEnergy" trace source of every
+ * EnergySource added to it. Updates are decimated: a sample is kept when at
+ * least Resolution has elapsed, or when the remaining energy moved by at
+ * least Threshold joules, since the last kept sample of the same source (a
+ * zero value disables the corresponding criterion; with both disabled every
+ * update is kept). The last update of every source is always recorded when
+ * the recorder is closed, so that the final energy is exact.
+ *
+ * Kept samples are buffered in per-source arrays and written in bulk once
+ * BufferSize samples are pending, as a sequence of binary blocks in native
+ * byte order:
+ *
+ * \verbatim
+   file   := "NS3ENRG1" block*
+   block  := uint32 nodeId, uint32 n, double time_s[n], double energy_j[n]
+   \endverbatim
+ *
+ * Blocks of the same node appear in chronological order; a reader simply
+ * concatenates them to obtain the depletion curve of each node.
+ *
+ * While FileName is empty, the samples are kept in memory and nothing is
+ * written: the file can be named once it is known, e.g. after a
+ * SimulatorCheckpoint::Branch(), so that each branch writes its own file
+ * instead of sharing the one opened by the parent. The file is opened by
+ * the first flush and later changes of FileName are ignored.
+ *
+ * The recorder is closed automatically when the simulator is destroyed.
+ */
+class EnergyRecorder : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+    EnergyRecorder();
+    ~EnergyRecorder() override;
+
+    /**
+     * @brief Start recording an energy source.
+     *
+     * The source must be installed on a node and provide a "RemainingEnergy"
+     * trace source. Its current remaining energy is recorded as the first
+     * sample.
+     *
+     * @param source the energy source to record
+     */
+    void AddSource(Ptr<EnergySource> source);
+
+    /**
+     * @brief Write all the buffered samples to the output file.
+     *
+     * Does nothing while FileName is empty.
+     */
+    void Flush();
+
+    /**
+     * @brief Record the last update of every source, flush and close the file.
+     *
+     * Further updates are ignored.
+     */
+    void Close();
+
+    /**
+     * @return the number of samples kept so far, including the flushed ones
+     */
+    uint64_t GetNSamples() const;
+
+  private:
+    void DoDispose() override;
+
+    /// Samples of a single energy source
+    struct Series
+    {
+        uint32_t nodeId;             //!< Node the source is installed on
+        std::vector<double> time;    //!< Buffered sample times (s)
+        std::vector<double> energy;  //!< Buffered remaining energies (J)
+        Time lastTime;               //!< Time of the last kept sample
+        double lastEnergy;           //!< Energy of the last kept sample
+        bool pending;                //!< Whether the last update was dropped
+        Time pendingTime;            //!< Time of the last dropped update
+        double pendingEnergy;        //!< Energy of the last dropped update
+    };
+
+    /**
+     * Trace sink of the "RemainingEnergy" trace source.
+     * @param index the index of the source in m_series
+     * @param oldValue the previous remaining energy (J)
+     * @param newValue the current remaining energy (J)
+     */
+    void RemainingEnergyTrace(uint32_t index, double oldValue, double newValue);
+
+    /**
+     * Keep a sample, flushing the buffers if they are full.
+     * @param series the series of the sample
+     * @param time the sample time
+     * @param energy the remaining energy
+     */
+    void Append(Series& series, Time time, double energy);
+
+    std::string m_fileName; //!< Output file name
+    Time m_resolution;      //!< Minimum time between kept samples
+    double m_threshold;     //!< Minimum energy change between kept samples (J)
+    uint32_t m_bufferSize;  //!< Number of samples buffered before flushing
+
+    std::vector<Series> m_series; //!< Per-source samples
+    std::ofstream m_file;         //!< Output file
+    uint32_t m_buffered;          //!< Number of samples not flushed yet
+    uint64_t m_nSamples;          //!< Number of samples kept
+    bool m_closed;                //!< Whether Close() has been called
+};
+
+} // namespace energy
+} // namespace ns3
+
+#endif /* ENERGY_RECORDER_H */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/basic-energy-source.h"
+#include "ns3/double.h"
+#include "ns3/energy-recorder-helper.h"
+#include "ns3/log.h"
+#include "ns3/node-container.h"
+#include "ns3/node.h"
+#include "ns3/simple-device-energy-model.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+using namespace ns3::energy;
+
+NS_LOG_COMPONENT_DEFINE("EnergyRecorderTestSuite");
+
+/**
+ * @ingroup energy-tests
+ *
+ * @brief EnergyRecorder decimation and file format test
+ */
+class EnergyRecorderTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * @param resolution the recorder Resolution attribute
+     * @param threshold the recorder Threshold attribute
+     * @param deferFileName whether the file is only named halfway through the run
+     */
+    EnergyRecorderTestCase(Time resolution, double threshold, bool deferFileName = false);
+
+  private:
+    void DoRun() override;
+
+    /// A recorded sample
+    struct Sample
+    {
+        double time;   //!< Time (s)
+        double energy; //!< Remaining energy (J)
+    };
+
+    /**
+     * Read back a recorder output file.
+     * @param fileName the file name
+     * @return the samples of each node
+     */
+    std::map<uint32_t, std::vector<Sample>> ReadFile(std::string fileName);
+
+    /**
+     * Trace sink of the "RemainingEnergy" trace, to know the last update.
+     * @param nodeId the node id
+     * @param oldValue the previous remaining energy
+     * @param newValue the current remaining energy
+     */
+    void RemainingEnergy(uint32_t nodeId, double oldValue, double newValue);
+
+    Time m_resolution;                       //!< Recorder resolution
+    double m_threshold;                      //!< Recorder threshold
+    bool m_deferFileName;                    //!< Whether the file is named late
+    std::map<uint32_t, Sample> m_lastUpdate; //!< Last update of each node
+    uint32_t m_nUpdates;                     //!< Number of trace updates
+};
+
+EnergyRecorderTestCase::EnergyRecorderTestCase(Time resolution,
+                                               double threshold,
+                                               bool deferFileName)
+    : TestCase("Energy recorder, resolution " + std::to_string(resolution.GetSeconds()) +
+               " s, threshold " + std::to_string(threshold) + " J" +
+               (deferFileName ? ", file named late" : "")),
+      m_resolution(resolution),
+      m_threshold(threshold),
+      m_deferFileName(deferFileName),
+      m_nUpdates(0)
+{
+}
+
+void
+EnergyRecorderTestCase::RemainingEnergy(uint32_t nodeId, double oldValue, double newValue)
+{
+    m_lastUpdate[nodeId] = {Simulator::Now().GetSeconds(), newValue};
+    ++m_nUpdates;
+}
+
+std::map<uint32_t, std::vector<EnergyRecorderTestCase::Sample>>
+EnergyRecorderTestCase::ReadFile(std::string fileName)
+{
+    std::map<uint32_t, std::vector<Sample>> series;
+    std::ifstream file(fileName, std::ios::binary);
+    NS_TEST_EXPECT_MSG_EQ(file.is_open(), true, "Unable to open " << fileName);
+
+    char magic[8];
+    file.read(magic, sizeof(magic));
+    NS_TEST_EXPECT_MSG_EQ(std::memcmp(magic, "NS3ENRG1", sizeof(magic)), 0, "Wrong magic");
+
+    uint32_t header[2];
+    while (file.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        std::vector<double> time(header[1]);
+        std::vector<double> energy(header[1]);
+        file.read(reinterpret_cast<char*>(time.data()), header[1] * sizeof(double));
+        file.read(reinterpret_cast<char*>(energy.data()), header[1] * sizeof(double));
+        for (uint32_t i = 0; i < header[1]; ++i)
+        {
+            series[header[0]].push_back({time[i], energy[i]});
+        }
+    }
+    return series;
+}
+
+void
+EnergyRecorderTestCase::DoRun()
+{
+    std::string fileName = CreateTempDirFilename("energy.bin");
+
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    EnergyRecorderHelper recorderHelper;
+    // Without a name, the samples are held in memory until one is given
+    recorderHelper.SetRecorderAttribute("FileName", StringValue(m_deferFileName ? "" : fileName));
+    recorderHelper.SetRecorderAttribute("Resolution", TimeValue(m_resolution));
+    recorderHelper.SetRecorderAttribute("Threshold", DoubleValue(m_threshold));
+    // Small buffers, so that the series are split across several blocks
+    recorderHelper.SetRecorderAttribute("BufferSize", UintegerValue(4));
+
+    for (uint32_t i = 0; i < nodes.GetN(); ++i)
+    {
+        Ptr<BasicEnergySource> es = CreateObject<BasicEnergySource>();
+        es->SetInitialEnergy(10);
+        es->SetEnergyUpdateInterval(MilliSeconds(100));
+        es->SetNode(nodes.Get(i));
+        nodes.Get(i)->AggregateObject(es);
+
+        Ptr<SimpleDeviceEnergyModel> sem = CreateObject<SimpleDeviceEnergyModel>();
+        sem->SetNode(nodes.Get(i));
+        sem->SetEnergySource(es);
+        es->AppendDeviceEnergyModel(sem);
+        // 0.3 and 0.6 W at 3 V: the second source drains twice as fast
+        sem->SetCurrentA(0.1 * (i + 1));
+
+        recorderHelper.Install(es);
+        es->TraceConnectWithoutContext(
+            "RemainingEnergy",
+            MakeCallback(&EnergyRecorderTestCase::RemainingEnergy, this).Bind(i));
+    }
+    Ptr<EnergyRecorder> recorder = recorderHelper.GetRecorder();
+    if (m_deferFileName)
+    {
+        Simulator::Schedule(Seconds(5), [recorder, fileName]() {
+            recorder->SetAttribute("FileName", StringValue(fileName));
+        });
+    }
+
+    Simulator::Stop(Seconds(10.05));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    auto series = ReadFile(fileName);
+    NS_TEST_ASSERT_MSG_EQ(series.size(), nodes.GetN(), "Wrong number of series");
+
+    uint64_t nSamples = 0;
+    for (auto& [nodeId, samples] : series)
+    {
+        nSamples += samples.size();
+        NS_TEST_ASSERT_MSG_GT(samples.size(), 2, "Too few samples for node " << nodeId);
+        NS_TEST_EXPECT_MSG_EQ(samples.front().time, 0.0, "First sample not at start");
+        NS_TEST_EXPECT_MSG_EQ(samples.front().energy, 10.0, "First sample not the initial energy");
+
+        // The final update is always recorded
+        NS_TEST_EXPECT_MSG_EQ(samples.back().time, m_lastUpdate[nodeId].time, "Wrong last time");
+        NS_TEST_EXPECT_MSG_EQ(samples.back().energy,
+                              m_lastUpdate[nodeId].energy,
+                              "Wrong last energy");
+        NS_TEST_EXPECT_MSG_LT(samples.back().energy, 10.0, "Energy was not consumed");
+
+        // All but the final sample honour the decimation criteria
+        for (std::size_t i = 1; i + 1 < samples.size(); ++i)
+        {
+            NS_TEST_EXPECT_MSG_GT(samples[i].time, samples[i - 1].time, "Samples out of order");
+            bool farEnough = m_resolution.IsStrictlyPositive() &&
+                             samples[i].time - samples[i - 1].time >=
+                                 m_resolution.GetSeconds() - 1e-9;
+            bool changedEnough = m_threshold > 0 && samples[i - 1].energy - samples[i].energy >=
+                                                        m_threshold - 1e-9;
+            NS_TEST_EXPECT_MSG_EQ((farEnough || changedEnough),
+                                  true,
+                                  "Sample " << i << " of node " << nodeId << " not decimated");
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(recorder->GetNSamples(), nSamples, "Wrong number of samples");
+    NS_TEST_EXPECT_MSG_LT(nSamples, m_nUpdates, "No update was dropped");
+}
+
+/**
+ * @ingroup energy-tests
+ *
+ * @brief EnergyRecorder TestSuite
+ */
+class EnergyRecorderTestSuite : public TestSuite
+{
+  public:
+    EnergyRecorderTestSuite();
+};
+
+EnergyRecorderTestSuite::EnergyRecorderTestSuite()
+    : TestSuite("energy-recorder", Type::UNIT)
+{
+    AddTestCase(new EnergyRecorderTestCase(Seconds(1), 0), TestCase::Duration::QUICK);
+    AddTestCase(new EnergyRecorderTestCase(Time(0), 0.5), TestCase::Duration::QUICK);
+    AddTestCase(new EnergyRecorderTestCase(Seconds(1), 0, true), TestCase::Duration::QUICK);
+}
+
+/// create an instance of the test suite
+static EnergyRecorderTestSuite g_energyRecorderTestSuite;
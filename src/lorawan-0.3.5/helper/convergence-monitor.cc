@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "convergence-monitor.h"
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/lora-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+namespace lorawan
+{
+
+NS_LOG_COMPONENT_DEFINE("ConvergenceMonitor");
+
+NS_OBJECT_ENSURE_REGISTERED(ConvergenceMonitor);
+
+TypeId
+ConvergenceMonitor::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::ConvergenceMonitor")
+            .SetParent<Object>()
+            .SetGroupName("lorawan")
+            .AddConstructor<ConvergenceMonitor>()
+            .AddAttribute("BatchInterval",
+                          "Duration of a batch",
+                          TimeValue(Seconds(30)),
+                          MakeTimeAccessor(&ConvergenceMonitor::m_batchInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("MinBatches",
+                          "Number of batches collected before convergence is tested",
+                          UintegerValue(5),
+                          MakeUintegerAccessor(&ConvergenceMonitor::m_minBatches),
+                          MakeUintegerChecker<uint32_t>(2))
+            .AddAttribute("PdrHalfWidth",
+                          "Target confidence interval half-width of the packet delivery ratio",
+                          DoubleValue(0.01),
+                          MakeDoubleAccessor(&ConvergenceMonitor::m_pdrHalfWidth),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("EnergyPerBitRelativeHalfWidth",
+                          "Target confidence interval half-width of the energy per delivered "
+                          "bit, relative to its mean",
+                          DoubleValue(0.05),
+                          MakeDoubleAccessor(&ConvergenceMonitor::m_energyRelHalfWidth),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("ConfidenceLevel",
+                          "Confidence level of the intervals",
+                          DoubleValue(0.95),
+                          MakeDoubleAccessor(&ConvergenceMonitor::m_confidenceLevel),
+                          MakeDoubleChecker<double>(0.5, 0.999))
+            .AddAttribute("StopSimulation",
+                          "Whether to stop the simulation once the run has converged",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&ConvergenceMonitor::m_stopSimulation),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+ConvergenceMonitor::ConvergenceMonitor()
+    : m_hasPrevious(false),
+      m_convergenceTime(Seconds(0)),
+      m_converged(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+ConvergenceMonitor::~ConvergenceMonitor()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+ConvergenceMonitor::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_batchEvent.Cancel();
+    m_energyModels = energy::DeviceEnergyModelContainer();
+    m_current = OpenBatch();
+    m_previous = OpenBatch();
+    Object::DoDispose();
+}
+
+void
+ConvergenceMonitor::Install(NodeContainer endDevices, NodeContainer gateways)
+{
+    NS_LOG_FUNCTION(this);
+
+    for (auto node = endDevices.Begin(); node != endDevices.End(); ++node)
+    {
+        Ptr<LoraNetDevice> dev = DynamicCast<LoraNetDevice>((*node)->GetDevice(0));
+        NS_ASSERT_MSG(dev, "Node " << (*node)->GetId() << " has no LoraNetDevice");
+        dev->GetPhy()->TraceConnectWithoutContext(
+            "StartSending",
+            MakeCallback(&ConvergenceMonitor::StartSending, this));
+    }
+    for (auto node = gateways.Begin(); node != gateways.End(); ++node)
+    {
+        Ptr<LoraNetDevice> dev = DynamicCast<LoraNetDevice>((*node)->GetDevice(0));
+        NS_ASSERT_MSG(dev, "Node " << (*node)->GetId() << " has no LoraNetDevice");
+        dev->GetPhy()->TraceConnectWithoutContext(
+            "ReceivedPacket",
+            MakeCallback(&ConvergenceMonitor::ReceivedPacket, this));
+    }
+
+    m_current = OpenBatch();
+    m_current.startEnergy = GetConsumedEnergy();
+    m_hasPrevious = false;
+    m_batchEvent.Cancel();
+    m_batchEvent = Simulator::Schedule(m_batchInterval, &ConvergenceMonitor::EndBatch, this);
+}
+
+void
+ConvergenceMonitor::SetEnergyModels(energy::DeviceEnergyModelContainer models)
+{
+    NS_LOG_FUNCTION(this);
+    m_energyModels = models;
+    m_current.startEnergy = GetConsumedEnergy();
+}
+
+void
+ConvergenceMonitor::StartSending(Ptr<const Packet> packet, uint32_t nodeId)
+{
+    NS_LOG_FUNCTION(this << packet << nodeId);
+    m_current.sent.insert(packet->GetUid());
+}
+
+void
+ConvergenceMonitor::ReceivedPacket(Ptr<const Packet> packet, uint32_t nodeId)
+{
+    NS_LOG_FUNCTION(this << packet << nodeId);
+    uint64_t uid = packet->GetUid();
+    for (OpenBatch* batch : {&m_current, &m_previous})
+    {
+        if (batch->sent.count(uid))
+        {
+            if (batch->received.insert(uid).second)
+            {
+                batch->receivedBits += packet->GetSize() * 8;
+            }
+            return;
+        }
+    }
+}
+
+void
+ConvergenceMonitor::EndBatch()
+{
+    NS_LOG_FUNCTION(this);
+
+    double energy = GetConsumedEnergy();
+    if (m_hasPrevious)
+    {
+        CloseBatch(m_previous);
+    }
+    m_current.endEnergy = energy;
+    m_previous = std::move(m_current);
+    m_hasPrevious = true;
+    m_current = OpenBatch();
+    m_current.startEnergy = energy;
+
+    NS_LOG_DEBUG("Batch " << m_pdr.n << ": PDR " << GetPdr() << " +- " << GetPdrHalfWidth()
+                          << ", energy per bit " << GetEnergyPerBit() << " +- "
+                          << GetEnergyPerBitHalfWidth());
+
+    bool converged = m_pdr.n >= m_minBatches && GetPdrHalfWidth() <= m_pdrHalfWidth;
+    if (converged && m_energyPerBit.n > 0)
+    {
+        converged = m_energyPerBit.n >= m_minBatches &&
+                    GetEnergyPerBitHalfWidth() <= m_energyRelHalfWidth * GetEnergyPerBit();
+    }
+
+    if (converged)
+    {
+        NS_LOG_INFO("Converged after " << m_pdr.n << " batches at "
+                                       << Simulator::Now().As(Time::S));
+        m_converged = true;
+        m_convergenceTime = Simulator::Now();
+        if (m_stopSimulation)
+        {
+            Simulator::Stop();
+        }
+        return;
+    }
+    m_batchEvent = Simulator::Schedule(m_batchInterval, &ConvergenceMonitor::EndBatch, this);
+}
+
+void
+ConvergenceMonitor::CloseBatch(const OpenBatch& batch)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (batch.sent.empty())
+    {
+        return;
+    }
+    NS_ASSERT(batch.received.size() <= batch.sent.size());
+    m_pdr.Update(static_cast<double>(batch.received.size()) / batch.sent.size());
+    if (batch.receivedBits > 0 && m_energyModels.GetN() > 0)
+    {
+        m_energyPerBit.Update((batch.endEnergy - batch.startEnergy) / batch.receivedBits);
+    }
+}
+
+double
+ConvergenceMonitor::GetConsumedEnergy() const
+{
+    double energy = 0;
+    for (auto model = m_energyModels.Begin(); model != m_energyModels.End(); ++model)
+    {
+        energy += (*model)->GetTotalEnergyConsumption();
+    }
+    return energy;
+}
+
+void
+ConvergenceMonitor::BatchMeans::Update(double value)
+{
+    ++n;
+    double delta = value - mean;
+    mean += delta / n;
+    m2 += delta * (value - mean);
+}
+
+double
+ConvergenceMonitor::GetHalfWidth(const BatchMeans& means) const
+{
+    if (means.n < 2)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    // Two-sided standard normal quantile, by bisection on the error function
+    double lo = 0;
+    double hi = 10;
+    for (int i = 0; i < 60; ++i)
+    {
+        double mid = (lo + hi) / 2;
+        if (std::erf(mid / std::sqrt(2.0)) < m_confidenceLevel)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    double z = (lo + hi) / 2;
+
+    // Cornish-Fisher expansion of the Student-t quantile
+    double df = means.n - 1;
+    double z3 = z * z * z;
+    double z5 = z3 * z * z;
+    double t = z + (z3 + z) / (4 * df) + (5 * z5 + 16 * z3 + 3 * z) / (96 * df * df);
+
+    double variance = means.m2 / (means.n - 1);
+    return t * std::sqrt(variance / means.n);
+}
+
+bool
+ConvergenceMonitor::IsConverged() const
+{
+    return m_converged;
+}
+
+Time
+ConvergenceMonitor::GetConvergenceTime() const
+{
+    return m_convergenceTime;
+}
+
+uint32_t
+ConvergenceMonitor::GetNBatches() const
+{
+    return m_pdr.n;
+}
+
+double
+ConvergenceMonitor::GetPdr() const
+{
+    return m_pdr.mean;
+}
+
+double
+ConvergenceMonitor::GetPdrHalfWidth() const
+{
+    return GetHalfWidth(m_pdr);
+}
+
+double
+ConvergenceMonitor::GetEnergyPerBit() const
+{
+    return m_energyPerBit.mean;
+}
+
+double
+ConvergenceMonitor::GetEnergyPerBitHalfWidth() const
+{
+    return GetHalfWidth(m_energyPerBit);
+}
+
+} // namespace lorawan
+} // namespace ns3
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef CONVERGENCE_MONITOR_H
+#define CONVERGENCE_MONITOR_H
+
+#include "ns3/device-energy-model-container.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/packet.h"
+
+#include <set>
+
+namespace ns3
+{
+namespace lorawan
+{
+
+/**
+ * @ingroup lorawan
+ *
+ * Sequential stopping rule for LoRaWAN uplink simulations.
+ *
+ * The monitor counts the packets whose transmission starts at the end
+ * devices ("StartSending" PHY trace) and the packets successfully received
+ * by the gateways ("ReceivedPacket" PHY trace), and, optionally, the energy
+ * consumed by a set of device energy models. Every BatchInterval it closes a
+ * batch and computes the batch packet delivery ratio and, if energy models
+ * were given and some bits were delivered, the batch energy per delivered
+ * bit.
+ *
+ * The batch values are treated as independent samples (method of batch
+ * means). Once at least MinBatches batches have been collected, the
+ * Student-t confidence interval of both means is evaluated at
+ * ConfidenceLevel; the run has converged when the PDR half-width is below
+ * PdrHalfWidth and the energy-per-bit half-width, relative to its mean, is
+ * below EnergyPerBitRelativeHalfWidth. The energy criterion is ignored
+ * while no bit has been delivered. On convergence the simulation is stopped
+ * if StopSimulation is set.
+ *
+ * A packet belongs to the batch in which its transmission started, even if it
+ * is received after the batch has ended: a batch is only closed at the end
+ * of the following one, so that the PDR of a batch never exceeds one and
+ * neighbouring batches do not share packets. This assumes that the time on
+ * air is shorter than BatchInterval, and delays the stopping rule by one
+ * batch. Batches in which no packet was sent are skipped, and packets
+ * received by several gateways are counted once.
+ */
+class ConvergenceMonitor : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    ConvergenceMonitor();           //!< Default constructor
+    ~ConvergenceMonitor() override; //!< Destructor
+
+    /**
+     * Connect to the PHY traces of the given devices and start the first batch.
+     *
+     * @param endDevices The end devices whose transmissions are counted.
+     * @param gateways The gateways whose receptions are counted.
+     */
+    void Install(NodeContainer endDevices, NodeContainer gateways);
+
+    /**
+     * Set the energy models whose consumption is charged to the delivered bits.
+     *
+     * @param models The device energy models.
+     */
+    void SetEnergyModels(energy::DeviceEnergyModelContainer models);
+
+    /**
+     * @return Whether the stopping rule has been satisfied.
+     */
+    bool IsConverged() const;
+
+    /**
+     * @return The simulation time at which the run converged, or zero.
+     */
+    Time GetConvergenceTime() const;
+
+    /**
+     * @return The number of batches collected so far.
+     */
+    uint32_t GetNBatches() const;
+
+    /**
+     * @return The mean of the batch packet delivery ratios.
+     */
+    double GetPdr() const;
+
+    /**
+     * @return The confidence interval half-width of the packet delivery ratio.
+     */
+    double GetPdrHalfWidth() const;
+
+    /**
+     * @return The mean of the batch energies per delivered bit (J/bit).
+     */
+    double GetEnergyPerBit() const;
+
+    /**
+     * @return The confidence interval half-width of the energy per bit (J/bit).
+     */
+    double GetEnergyPerBitHalfWidth() const;
+
+  private:
+    void DoDispose() override;
+
+    /// Packets and energy of a batch that has not been closed yet
+    struct OpenBatch
+    {
+        std::set<uint64_t> sent;     //!< Packets sent in the batch
+        std::set<uint64_t> received; //!< Packets of the batch received so far
+        uint64_t receivedBits = 0;   //!< Bits of the batch delivered so far
+        double startEnergy = 0;      //!< Energy consumed at batch start
+        double endEnergy = 0;        //!< Energy consumed at batch end
+    };
+
+    /// Running mean and variance of the batch values
+    struct BatchMeans
+    {
+        uint32_t n = 0;  //!< Number of batches
+        double mean = 0; //!< Mean of the batch values
+        double m2 = 0;   //!< Sum of squared differences from the mean
+
+        /**
+         * Add a batch value.
+         * @param value The batch value.
+         */
+        void Update(double value);
+    };
+
+    /**
+     * Trace sink for the end device "StartSending" trace.
+     * @param packet The packet being sent.
+     * @param nodeId The sender node id.
+     */
+    void StartSending(Ptr<const Packet> packet, uint32_t nodeId);
+
+    /**
+     * Trace sink for the gateway "ReceivedPacket" trace.
+     * @param packet The received packet.
+     * @param nodeId The receiver node id.
+     */
+    void ReceivedPacket(Ptr<const Packet> packet, uint32_t nodeId);
+
+    /**
+     * End the current batch, close the previous one and evaluate the stopping rule.
+     */
+    void EndBatch();
+
+    /**
+     * Add the values of a closed batch to the batch means.
+     * @param batch The batch.
+     */
+    void CloseBatch(const OpenBatch& batch);
+
+    /**
+     * @return The energy consumed so far by the monitored energy models (J).
+     */
+    double GetConsumedEnergy() const;
+
+    /**
+     * @param means The batch means.
+     * @return The confidence interval half-width of their mean.
+     */
+    double GetHalfWidth(const BatchMeans& means) const;
+
+    Time m_batchInterval;        //!< Duration of a batch
+    uint32_t m_minBatches;       //!< Batches needed before testing convergence
+    double m_pdrHalfWidth;       //!< Target PDR half-width
+    double m_energyRelHalfWidth; //!< Target relative energy-per-bit half-width
+    double m_confidenceLevel;    //!< Confidence level of the intervals
+    bool m_stopSimulation;       //!< Whether to stop the simulation on convergence
+
+    energy::DeviceEnergyModelContainer m_energyModels; //!< Monitored energy models
+    EventId m_batchEvent;                              //!< Event ending the current batch
+    OpenBatch m_current;                               //!< Batch in progress
+    OpenBatch m_previous;                              //!< Ended batch, still receiving
+    bool m_hasPrevious;                                //!< Whether m_previous is valid
+
+    BatchMeans m_pdr;          //!< Batch packet delivery ratios
+    BatchMeans m_energyPerBit; //!< Batch energies per delivered bit
+    Time m_convergenceTime;    //!< Time of convergence
+    bool m_converged;          //!< Whether the run converged
+};
+
+} // namespace lorawan
+} // namespace ns3
+
+#endif /* CONVERGENCE_MONITOR_H */
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "lora-coverage-estimator.h"
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/end-device-lora-phy.h"
+#include "ns3/gateway-lora-phy.h"
+#include "ns3/log.h"
+#include "ns3/lora-frame-header.h"
+#include "ns3/lora-phy.h"
+#include "ns3/lorawan-mac-header.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+namespace lorawan
+{
+
+NS_LOG_COMPONENT_DEFINE("LoraCoverageEstimator");
+
+LoraCoverageEstimator::LoraCoverageEstimator()
+    : m_txPowerDbm(14),
+      m_pktSize(10),
+      m_period(Seconds(600)),
+      m_nChannels(1),
+      m_collisions(LoraInterferenceHelper::collisionMatrix)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LoraCoverageEstimator::~LoraCoverageEstimator()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LoraCoverageEstimator::SetPropagationLossModel(Ptr<PropagationLossModel> loss)
+{
+    m_loss = loss;
+}
+
+void
+LoraCoverageEstimator::SetTxPower(double txPowerDbm)
+{
+    m_txPowerDbm = txPowerDbm;
+}
+
+void
+LoraCoverageEstimator::SetPacketSize(uint8_t size)
+{
+    m_pktSize = size;
+}
+
+void
+LoraCoverageEstimator::SetPeriod(Time period)
+{
+    NS_ASSERT_MSG(period.IsStrictlyPositive(), "The period must be positive");
+    m_period = period;
+}
+
+void
+LoraCoverageEstimator::SetNChannels(uint32_t nChannels)
+{
+    NS_ASSERT_MSG(nChannels > 0, "At least one channel is needed");
+    m_nChannels = nChannels;
+}
+
+void
+LoraCoverageEstimator::SetCollisionMatrix(LoraInterferenceHelper::CollisionMatrix matrix)
+{
+    m_collisions = matrix;
+}
+
+void
+LoraCoverageEstimator::AddGateway(Vector position)
+{
+    m_gateways.push_back(position);
+}
+
+Time
+LoraCoverageEstimator::GetOnAirTime(uint8_t sf) const
+{
+    // Same headers and transmission parameters as an uplink sent by
+    // ClassAEndDeviceLorawanMac
+    Ptr<Packet> packet = Create<Packet>(m_pktSize);
+    LoraFrameHeader frameHdr;
+    frameHdr.SetAsUplink();
+    frameHdr.SetFPort(1);
+    packet->AddHeader(frameHdr);
+    LorawanMacHeader macHdr;
+    macHdr.SetMType(LorawanMacHeader::UNCONFIRMED_DATA_UP);
+    packet->AddHeader(macHdr);
+
+    LoraTxParameters params;
+    params.sf = sf;
+    params.lowDataRateOptimizationEnabled = LoraPhy::GetTSym(params) > MilliSeconds(16);
+    return LoraPhy::GetOnAirTime(packet, params);
+}
+
+std::vector<LoraCoverageEstimator::DeviceEstimate>
+LoraCoverageEstimator::Estimate(const std::vector<Vector>& devices) const
+{
+    NS_LOG_FUNCTION(this << devices.size());
+    NS_ASSERT_MSG(m_loss, "No propagation loss model was set");
+    NS_ASSERT_MSG(!m_gateways.empty(), "No gateway was added");
+
+    const auto& matrix = m_collisions == LoraInterferenceHelper::ALOHA
+                             ? LoraInterferenceHelper::collisionSnirAloha
+                             : LoraInterferenceHelper::collisionSnirGoursaud;
+
+    std::size_t n = devices.size();
+    std::size_t nGateways = m_gateways.size();
+
+    // Received powers, gateway-major, and spreading factor assignment
+    Ptr<ConstantPositionMobilityModel> device = CreateObject<ConstantPositionMobilityModel>();
+    Ptr<ConstantPositionMobilityModel> gateway = CreateObject<ConstantPositionMobilityModel>();
+    std::vector<double> rxPower(nGateways * n);
+    std::vector<DeviceEstimate> estimates(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        device->SetPosition(devices[i]);
+        // LorawanMacHelper::SetSpreadingFactorsUp assumes 14 dBm whatever the
+        // actual transmission power, which only enters the link budget
+        double best14 = -std::numeric_limits<double>::infinity();
+        for (std::size_t g = 0; g < nGateways; ++g)
+        {
+            gateway->SetPosition(m_gateways[g]);
+            double power14 = m_loss->CalcRxPower(14, device, gateway);
+            rxPower[g * n + i] = power14 + m_txPowerDbm - 14;
+            best14 = std::max(best14, power14);
+        }
+
+        // As LorawanMacHelper::SetSpreadingFactorsUp: out of range devices use SF12
+        uint8_t sf = 12;
+        for (uint8_t s = 7; s < 12; ++s)
+        {
+            if (best14 > EndDeviceLoraPhy::sensitivity[s - 7])
+            {
+                sf = s;
+                break;
+            }
+        }
+        estimates[i] = {sf, best14 + m_txPowerDbm - 14, false, 0};
+    }
+
+    std::array<double, 6> onAir;
+    for (uint8_t s = 0; s < 6; ++s)
+    {
+        onAir[s] = GetOnAirTime(s + 7).GetSeconds();
+    }
+    // Packets started per second by one device on one channel
+    double rate = 1.0 / (m_period.GetSeconds() * m_nChannels);
+
+    std::vector<double> missed(n, 1.0);
+    std::array<std::vector<double>, 6> powers;
+    for (std::size_t g = 0; g < nGateways; ++g)
+    {
+        const double* gwPower = &rxPower[g * n];
+        for (auto& sfPowers : powers)
+        {
+            sfPowers.clear();
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            powers[estimates[i].sf - 7].push_back(gwPower[i]);
+        }
+        for (auto& sfPowers : powers)
+        {
+            std::sort(sfPowers.begin(), sfPowers.end());
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            uint8_t s = estimates[i].sf - 7;
+            double power = gwPower[i];
+            if (power < GatewayLoraPhy::sensitivity[s])
+            {
+                continue;
+            }
+            estimates[i].covered = true;
+
+            // Interferers whose power is high enough to destroy the packet
+            double vulnerable = 0;
+            for (uint8_t k = 0; k < 6; ++k)
+            {
+                double threshold = power - matrix[s][k];
+                auto destroyers = powers[k].end() - std::upper_bound(powers[k].begin(),
+                                                                     powers[k].end(),
+                                                                     threshold);
+                if (k == s && power > threshold)
+                {
+                    --destroyers; // the device itself
+                }
+                vulnerable += destroyers * (onAir[s] + onAir[k]);
+            }
+            missed[i] *= 1 - std::exp(-rate * vulnerable);
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        estimates[i].pdr = 1 - missed[i];
+    }
+    return estimates;
+}
+
+} // namespace lorawan
+} // namespace ns3
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LORA_COVERAGE_ESTIMATOR_H
+#define LORA_COVERAGE_ESTIMATOR_H
+
+#include "ns3/lora-interference-helper.h"
+#include "ns3/nstime.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/vector.h"
+
+#include <vector>
+
+namespace ns3
+{
+namespace lorawan
+{
+
+/**
+ * @ingroup lorawan
+ *
+ * Analytical estimate of the uplink coverage and packet delivery ratio of a
+ * LoRaWAN deployment, without running a simulation.
+ *
+ * The estimate uses the same models as the simulation: received powers come
+ * from the given PropagationLossModel chain, spreading factors are assigned
+ * as LorawanMacHelper::SetSpreadingFactorsUp does, coverage is checked
+ * against GatewayLoraPhy::sensitivity, times on air come from
+ * LoraPhy::GetOnAirTime for a packet carrying the LoRaWAN headers, and
+ * collisions follow the LoraInterferenceHelper SNIR matrix.
+ *
+ * Every device is assumed to send Poisson traffic at the rate of one packet
+ * per period, spread over nChannels channels (unslotted ALOHA). At a given
+ * gateway, a packet of device i is destroyed by a packet of device j that
+ * overlaps it, i.e. that starts in a window of T_i + T_j around it, when the
+ * power difference of the two is below the matrix entry of their spreading
+ * factors, so that
+ *
+ *   PDR_i,g = 1{P_i,g > S(SF_i)} exp(-sum_j (T_i + T_j) / (period * nChannels))
+ *
+ * where the sum runs over the destructive interferers. Gateways are treated
+ * as independent: PDR_i = 1 - prod_g (1 - PDR_i,g). Interference is
+ * evaluated pairwise and for the whole overlap, the number of gateway
+ * reception paths and the duty cycle are ignored.
+ *
+ * Devices are grouped by spreading factor and sorted by received power, so
+ * that an estimate costs O(N log N) per gateway instead of O(N^2).
+ */
+class LoraCoverageEstimator
+{
+  public:
+    /// Estimate for one end device
+    struct DeviceEstimate
+    {
+        uint8_t sf;        //!< Assigned spreading factor
+        double rxPowerDbm; //!< Power received by the best gateway (dBm)
+        bool covered;      //!< Whether some gateway can decode the device
+        double pdr;        //!< Estimated packet delivery ratio
+    };
+
+    LoraCoverageEstimator();  //!< Default constructor
+    ~LoraCoverageEstimator(); //!< Destructor
+
+    /**
+     * Set the propagation loss model chain of the channel.
+     *
+     * @param loss The first model of the chain.
+     */
+    void SetPropagationLossModel(Ptr<PropagationLossModel> loss);
+
+    /**
+     * Set the transmission power of the end devices.
+     *
+     * It is used for the link budget only: spreading factors are assigned
+     * for 14 dBm, as LorawanMacHelper::SetSpreadingFactorsUp does.
+     *
+     * @param txPowerDbm The transmission power (dBm).
+     */
+    void SetTxPower(double txPowerDbm);
+
+    /**
+     * Set the application payload size.
+     *
+     * @param size The payload size in bytes.
+     */
+    void SetPacketSize(uint8_t size);
+
+    /**
+     * Set the mean time between two packets of the same device.
+     *
+     * @param period The period.
+     */
+    void SetPeriod(Time period);
+
+    /**
+     * Set the number of channels the devices spread their packets over.
+     *
+     * @param nChannels The number of channels.
+     */
+    void SetNChannels(uint32_t nChannels);
+
+    /**
+     * Set the collision matrix.
+     *
+     * @param matrix The matrix type.
+     */
+    void SetCollisionMatrix(LoraInterferenceHelper::CollisionMatrix matrix);
+
+    /**
+     * Add a gateway.
+     *
+     * @param position The gateway position.
+     */
+    void AddGateway(Vector position);
+
+    /**
+     * Estimate the coverage and PDR of a set of end devices.
+     *
+     * @param devices The end device positions.
+     * @return One estimate per end device, in the same order.
+     */
+    std::vector<DeviceEstimate> Estimate(const std::vector<Vector>& devices) const;
+
+    /**
+     * Get the time on air of an uplink packet.
+     *
+     * @param sf The spreading factor.
+     * @return The time on air of a packet of the configured size.
+     */
+    Time GetOnAirTime(uint8_t sf) const;
+
+  private:
+    Ptr<PropagationLossModel> m_loss;                     //!< Propagation loss model chain
+    double m_txPowerDbm;                                  //!< End device transmission power
+    uint8_t m_pktSize;                                    //!< Application payload size
+    Time m_period;                                        //!< Time between two packets
+    uint32_t m_nChannels;                                 //!< Number of channels
+    LoraInterferenceHelper::CollisionMatrix m_collisions; //!< Collision matrix type
+    std::vector<Vector> m_gateways;                       //!< Gateway positions
+};
+
+} // namespace lorawan
+} // namespace ns3
+
+#endif /* LORA_COVERAGE_ESTIMATOR_H */
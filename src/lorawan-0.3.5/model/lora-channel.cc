@@ -18,6 +18,8 @@
 #include "ns3/simulator.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace ns3
 {
@@ -98,6 +100,35 @@ LoraChannel::GetDevice(std::size_t i) const
     return DynamicCast<NetDevice>(m_phyList[i]->GetDevice());
 }
 
+Time
+LoraChannel::GetMinimumDelay() const
+{
+    NS_LOG_FUNCTION(this);
+    // Drawing delays from a random model would change the simulation
+    Ptr<ConstantSpeedPropagationDelayModel> constantSpeed =
+        DynamicCast<ConstantSpeedPropagationDelayModel>(m_delay);
+    if (!constantSpeed)
+    {
+        return Time(0);
+    }
+    double distance = std::numeric_limits<double>::infinity();
+    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+    {
+        Ptr<NetDevice> device = (*i)->GetDevice();
+        for (auto j = i + 1; j != m_phyList.end(); j++)
+        {
+            Ptr<NetDevice> other = (*j)->GetDevice();
+            if (device && other && device->GetNode() == other->GetNode())
+            {
+                continue;
+            }
+            distance =
+                std::min(distance, (*i)->GetMobility()->GetDistanceFrom((*j)->GetMobility()));
+        }
+    }
+    return std::isinf(distance) ? Time::Max() : Seconds(distance / constantSpeed->GetSpeed());
+}
+
 void
 LoraChannel::Send(Ptr<LoraPhy> sender,
                   Ptr<Packet> packet,
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/*
+ * This file includes testing for the following components:
+ * - ConvergenceMonitor
+ */
+
+// Include headers of classes to test
+#include "utilities.h"
+
+#include "ns3/convergence-monitor.h"
+#include "ns3/core-module.h"
+#include "ns3/log.h"
+#include "ns3/periodic-sender-helper.h"
+
+// An essential include is test.h
+#include "ns3/test.h"
+
+using namespace ns3;
+using namespace lorawan;
+
+NS_LOG_COMPONENT_DEFINE("ConvergenceMonitorTestSuite");
+
+/**
+ * @ingroup lorawan
+ *
+ * It verifies that the ConvergenceMonitor stops a run once the packet delivery ratio is stable
+ */
+class ConvergenceStopTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param stopSimulation Value of the StopSimulation attribute.
+     */
+    ConvergenceStopTest(bool stopSimulation);
+    ~ConvergenceStopTest() override; //!< Destructor
+
+  private:
+    void DoRun() override;
+
+    bool m_stopSimulation; //!< Whether the monitor stops the simulation
+};
+
+// Add some help text to this case to describe what it is intended to test
+ConvergenceStopTest::ConvergenceStopTest(bool stopSimulation)
+    : TestCase(stopSimulation ? "Verify that a converged run is stopped early"
+                              : "Verify that convergence can be detected without stopping"),
+      m_stopSimulation(stopSimulation)
+{
+}
+
+// Reminder that the test case should clean up after itself
+ConvergenceStopTest::~ConvergenceStopTest()
+{
+}
+
+// This method is the pure virtual method from class TestCase that every
+// TestCase must implement
+void
+ConvergenceStopTest::DoRun()
+{
+    NS_LOG_DEBUG("ConvergenceStopTest");
+
+    // A single device in range: every packet is delivered
+    NetworkComponents components = InitializeNetwork(1, 1);
+
+    PeriodicSenderHelper appHelper;
+    appHelper.SetPeriod(Seconds(10));
+    appHelper.SetPacketSize(10);
+    ApplicationContainer apps = appHelper.Install(components.endDevices);
+    apps.Start(Seconds(1));
+
+    Ptr<ConvergenceMonitor> monitor = CreateObject<ConvergenceMonitor>();
+    monitor->SetAttribute("BatchInterval", TimeValue(Seconds(30)));
+    monitor->SetAttribute("MinBatches", UintegerValue(3));
+    monitor->SetAttribute("StopSimulation", BooleanValue(m_stopSimulation));
+    monitor->Install(components.endDevices, components.gateways);
+
+    Time stopTime = Seconds(1000);
+    Simulator::Stop(stopTime);
+    Simulator::Run();
+    Time endTime = Simulator::Now();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(monitor->IsConverged(), true, "The run did not converge");
+    NS_TEST_EXPECT_MSG_EQ(monitor->GetNBatches(), 3, "Converged after the wrong number of batches");
+    // Batches are closed one batch late
+    NS_TEST_EXPECT_MSG_EQ(monitor->GetConvergenceTime(), Seconds(120), "Wrong convergence time");
+    NS_TEST_EXPECT_MSG_EQ_TOL(monitor->GetPdr(), 1.0, 1e-9, "Wrong packet delivery ratio");
+    NS_TEST_EXPECT_MSG_EQ_TOL(monitor->GetPdrHalfWidth(), 0.0, 1e-9, "Wrong half-width");
+    if (m_stopSimulation)
+    {
+        NS_TEST_EXPECT_MSG_EQ(endTime, monitor->GetConvergenceTime(), "Run was not stopped");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_EQ(endTime, stopTime, "Run was stopped");
+    }
+}
+
+/**
+ * @ingroup lorawan
+ *
+ * The TestSuite class names the TestSuite, identifies what type of TestSuite, and enables the
+ * TestCases to be run. Typically, only the constructor for this class must be defined
+ */
+class ConvergenceMonitorTestSuite : public TestSuite
+{
+  public:
+    ConvergenceMonitorTestSuite(); //!< Default constructor
+};
+
+ConvergenceMonitorTestSuite::ConvergenceMonitorTestSuite()
+    : TestSuite("convergence-monitor", Type::UNIT)
+{
+    AddTestCase(new ConvergenceStopTest(true), Duration::QUICK);
+    AddTestCase(new ConvergenceStopTest(false), Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static ConvergenceMonitorTestSuite convergenceMonitorTestSuite;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/*
+ * This file includes testing for the following components:
+ * - LoraCoverageEstimator
+ */
+
+// Include headers of classes to test
+#include "ns3/core-module.h"
+#include "ns3/log.h"
+#include "ns3/lora-coverage-estimator.h"
+#include "ns3/propagation-loss-model.h"
+
+// An essential include is test.h
+#include "ns3/test.h"
+
+#include <cmath>
+
+using namespace ns3;
+using namespace lorawan;
+
+NS_LOG_COMPONENT_DEFINE("LoraCoverageEstimatorTestSuite");
+
+/**
+ * @ingroup lorawan
+ *
+ * It verifies the analytical coverage and ALOHA collision estimates
+ */
+class CoverageEstimateTest : public TestCase
+{
+  public:
+    CoverageEstimateTest();           //!< Default constructor
+    ~CoverageEstimateTest() override; //!< Destructor
+
+  private:
+    void DoRun() override;
+};
+
+// Add some help text to this case to describe what it is intended to test
+CoverageEstimateTest::CoverageEstimateTest()
+    : TestCase("Verify the coverage and PDR estimates of a simple deployment")
+{
+}
+
+// Reminder that the test case should clean up after itself
+CoverageEstimateTest::~CoverageEstimateTest()
+{
+}
+
+// This method is the pure virtual method from class TestCase that every
+// TestCase must implement
+void
+CoverageEstimateTest::DoRun()
+{
+    NS_LOG_DEBUG("CoverageEstimateTest");
+
+    Ptr<LogDistancePropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel>();
+    loss->SetPathLossExponent(3.76);
+    loss->SetReference(1, 7.7);
+
+    LoraCoverageEstimator estimator;
+    estimator.SetPropagationLossModel(loss);
+    estimator.SetPacketSize(20);
+    estimator.SetPeriod(Seconds(100));
+    estimator.SetCollisionMatrix(LoraInterferenceHelper::ALOHA);
+    estimator.AddGateway(Vector(0, 0, 15));
+
+    // A lone device next to the gateway always gets through at SF7
+    auto estimates = estimator.Estimate({Vector(10, 0, 1)});
+    NS_TEST_ASSERT_MSG_EQ(estimates.size(), 1, "Wrong number of estimates");
+    NS_TEST_EXPECT_MSG_EQ(unsigned(estimates[0].sf), 7, "Wrong spreading factor");
+    NS_TEST_EXPECT_MSG_EQ(estimates[0].covered, true, "Device not covered");
+    NS_TEST_EXPECT_MSG_EQ_TOL(estimates[0].pdr, 1.0, 1e-12, "Wrong PDR without interferers");
+
+    // Two devices on the same SF: any overlap is a collision under ALOHA,
+    // and a third one far away is out of range
+    estimates = estimator.Estimate({Vector(10, 0, 1), Vector(0, 10, 1), Vector(1e6, 0, 1)});
+    NS_TEST_ASSERT_MSG_EQ(estimates.size(), 3, "Wrong number of estimates");
+    double onAir = estimator.GetOnAirTime(7).GetSeconds();
+    double expected = std::exp(-2 * onAir / 100);
+    NS_TEST_EXPECT_MSG_EQ_TOL(estimates[0].pdr, expected, 1e-12, "Wrong ALOHA PDR");
+    NS_TEST_EXPECT_MSG_EQ_TOL(estimates[1].pdr, expected, 1e-12, "Wrong ALOHA PDR");
+    NS_TEST_EXPECT_MSG_EQ(unsigned(estimates[2].sf), 12, "Out of range device not on SF12");
+    NS_TEST_EXPECT_MSG_EQ(estimates[2].covered, false, "Out of range device covered");
+    NS_TEST_EXPECT_MSG_EQ(estimates[2].pdr, 0.0, "Out of range device delivers packets");
+
+    // The spreading factor is assigned for 14 dBm, the power only shifts the link budget
+    estimates = estimator.Estimate({Vector(4000, 0, 1)});
+    NS_TEST_EXPECT_MSG_EQ(unsigned(estimates[0].sf), 9, "Wrong spreading factor at 14 dBm");
+    double rxPower14 = estimates[0].rxPowerDbm;
+    estimator.SetTxPower(30);
+    estimates = estimator.Estimate({Vector(4000, 0, 1)});
+    NS_TEST_EXPECT_MSG_EQ(unsigned(estimates[0].sf), 9, "Spreading factor follows the power");
+    NS_TEST_EXPECT_MSG_EQ_TOL(estimates[0].rxPowerDbm, rxPower14 + 16, 1e-9, "Wrong power");
+    estimator.SetTxPower(14);
+
+    // Under the default matrix a much stronger device captures the channel
+    estimator.SetCollisionMatrix(LoraInterferenceHelper::GOURSAUD);
+    estimates = estimator.Estimate({Vector(10, 0, 1), Vector(200, 0, 1)});
+    NS_TEST_EXPECT_MSG_EQ_TOL(estimates[0].pdr, 1.0, 1e-12, "Strong device did not capture");
+    NS_TEST_EXPECT_MSG_LT(estimates[1].pdr, 1.0, "Weak device was not interfered");
+}
+
+/**
+ * @ingroup lorawan
+ *
+ * The TestSuite class names the TestSuite, identifies what type of TestSuite, and enables the
+ * TestCases to be run. Typically, only the constructor for this class must be defined
+ */
+class LoraCoverageEstimatorTestSuite : public TestSuite
+{
+  public:
+    LoraCoverageEstimatorTestSuite(); //!< Default constructor
+};
+
+LoraCoverageEstimatorTestSuite::LoraCoverageEstimatorTestSuite()
+    : TestSuite("lora-coverage-estimator", Type::UNIT)
+{
+    AddTestCase(new CoverageEstimateTest, Duration::QUICK);
+}
+
+// Do not forget to allocate an instance of this TestSuite
+static LoraCoverageEstimatorTestSuite loraCoverageEstimatorTestSuite;
@@ -180,9 +180,9 @@ class NullMessageSimulatorImpl : public SimulatorImpl
     Ptr<Scheduler> m_events;
 
     /** Next event unique id. */
-    uint32_t m_uid;
+    uint64_t m_uid;
     /** Unique id of the current event. */
-    uint32_t m_currentUid;
+    uint64_t m_currentUid;
     /** Timestamp of the current event. */
     uint64_t m_currentTs;
     /** Execution context of the current event. */
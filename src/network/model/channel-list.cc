@@ -14,6 +14,8 @@
 #include "ns3/object-vector.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -237,4 +239,19 @@ ChannelList::GetNChannels()
     return ChannelListPriv::Get()->GetNChannels();
 }
 
+Time
+ChannelList::GetMinimumDelay()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    Time delay = Time::Max();
+    for (auto i = Begin(); i != End(); i++)
+    {
+        if ((*i)->GetNDevices() > 1)
+        {
+            delay = std::min(delay, (*i)->GetMinimumDelay());
+        }
+    }
+    return delay;
+}
+
 } // namespace ns3
@@ -7,6 +7,7 @@
 #ifndef CHANNEL_LIST_H
 #define CHANNEL_LIST_H
 
+#include "ns3/nstime.h"
 #include "ns3/ptr.h"
 
 #include <vector>
@@ -57,6 +58,14 @@ class ChannelList
      * @returns the number of channels currently in the list.
      */
     static uint32_t GetNChannels();
+    /**
+     * @returns the smallest Channel::GetMinimumDelay() of the channels
+     * connecting more than one device, or Time::Max() if there is none.
+     *
+     * This is a lookahead for MultithreadedSimulatorImpl, as long as the
+     * nodes only interact through these channels.
+     */
+    static Time GetMinimumDelay();
 };
 
 } // namespace ns3
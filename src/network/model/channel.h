@@ -5,6 +5,7 @@
 #ifndef NS3_CHANNEL_H
 #define NS3_CHANNEL_H
 
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
@@ -64,6 +65,16 @@ class Channel : public Object
      */
     virtual Ptr<NetDevice> GetDevice(std::size_t i) const = 0;
 
+    /**
+     * @returns the smallest delay between the start of a transmission and
+     * the reception event it schedules on another node.
+     *
+     * This is the lookahead of the channel for MultithreadedSimulatorImpl:
+     * nodes which only interact through it can run that far apart. The
+     * default implementation returns zero, i.e. no lookahead.
+     */
+    virtual Time GetMinimumDelay() const;
+
   private:
     uint32_t m_id; //!< Channel id for this channel
 };
@@ -90,6 +90,12 @@ class PointToPointChannel : public Channel
      */
     Ptr<NetDevice> GetDevice(std::size_t i) const override;
 
+    /**
+     * @brief Get the lookahead of this channel, i.e. its delay
+     * @returns Time delay
+     */
+    Time GetMinimumDelay() const override;
+
   protected:
     /**
      * @brief Get the delay associated with this channel
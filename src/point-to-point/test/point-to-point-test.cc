@@ -6,12 +6,16 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include "ns3/channel-list.h"
+#include "ns3/config.h"
 #include "ns3/drop-tail-queue.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 
 #include <string>
 
@@ -128,6 +132,104 @@ PointToPointTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @brief Test a PointToPoint link between two threads of
+ * MultithreadedSimulatorImpl, with the channel delay as lookahead
+ */
+class PointToPointMultithreadedTest : public TestCase
+{
+  public:
+    /**
+     * @brief Create the test
+     */
+    PointToPointMultithreadedTest();
+
+    /**
+     * @brief Run the test
+     */
+    void DoRun() override;
+
+  private:
+    /**
+     * @brief Receive a packet
+     * @param dev the receiving device
+     * @param pkt the packet
+     * @param mode the protocol
+     * @param sender the sender address
+     * @returns true
+     */
+    bool RxPacket(Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address& sender);
+
+    uint32_t m_received; //!< number of packets received
+    Time m_rxTime;       //!< time of the last reception
+    uint32_t m_context;  //!< context of the last reception
+};
+
+PointToPointMultithreadedTest::PointToPointMultithreadedTest()
+    : TestCase("PointToPoint across MultithreadedSimulatorImpl threads"),
+      m_received(0),
+      m_context(0)
+{
+}
+
+bool
+PointToPointMultithreadedTest::RxPacket(Ptr<NetDevice> dev,
+                                        Ptr<const Packet> pkt,
+                                        uint16_t mode,
+                                        const Address& sender)
+{
+    m_received++;
+    m_rxTime = Simulator::Now();
+    m_context = Simulator::GetContext();
+    return true;
+}
+
+void
+PointToPointMultithreadedTest::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::ThreadCount", UintegerValue(2));
+
+    Ptr<Node> a = CreateObject<Node>();
+    Ptr<Node> b = CreateObject<Node>();
+    Ptr<PointToPointNetDevice> devA = CreateObject<PointToPointNetDevice>();
+    Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice>();
+    Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel>();
+    channel->SetAttribute("Delay", TimeValue(MilliSeconds(2)));
+    devA->SetAttribute("DataRate", StringValue("8Mbps"));
+
+    devA->Attach(channel);
+    devA->SetAddress(Mac48Address::Allocate());
+    devA->SetQueue(CreateObject<DropTailQueue<Packet>>());
+    devB->Attach(channel);
+    devB->SetAddress(Mac48Address::Allocate());
+    devB->SetQueue(CreateObject<DropTailQueue<Packet>>());
+
+    a->AddDevice(devA);
+    b->AddDevice(devB);
+    devB->SetReceiveCallback(MakeCallback(&PointToPointMultithreadedTest::RxPacket, this));
+
+    NS_TEST_EXPECT_MSG_EQ(ChannelList::GetMinimumDelay(), MilliSeconds(2), "Wrong lookahead");
+    Simulator::GetImplementation()->SetAttribute("Lookahead",
+                                                 TimeValue(ChannelList::GetMinimumDelay()));
+
+    // 1000 bytes and a 2-byte PPP header at 8 Mbit/s take 1002 us
+    Simulator::ScheduleWithContext(a->GetId(), Seconds(1), [devA]() {
+        devA->Send(Create<Packet>(1000), devA->GetBroadcast(), 0x800);
+    });
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_received, 1U, "Packet lost");
+    NS_TEST_EXPECT_MSG_EQ(m_rxTime,
+                          Seconds(1) + MicroSeconds(1002) + MilliSeconds(2),
+                          "Wrong reception time");
+    NS_TEST_EXPECT_MSG_EQ(m_context, b->GetId(), "Received out of the context of node b");
+
+    Simulator::Destroy();
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
 /**
  * @brief TestSuite for PointToPoint module
  */
@@ -144,6 +246,7 @@ PointToPointTestSuite::PointToPointTestSuite()
     : TestSuite("devices-point-to-point", Type::UNIT)
 {
     AddTestCase(new PointToPointTest, TestCase::Duration::QUICK);
+    AddTestCase(new PointToPointMultithreadedTest, TestCase::Duration::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "log-linear-histogram.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LogLinearHistogram");
+
+LogLinearHistogram::LogLinearHistogram()
+    : LogLinearHistogram(1e-6, 1e6, 64)
+{
+}
+
+LogLinearHistogram::LogLinearHistogram(double lowest, double highest, uint32_t subBuckets)
+    : m_subBuckets(subBuckets),
+      m_offset(0)
+{
+    NS_LOG_FUNCTION(this << lowest << highest << subBuckets);
+    NS_ABORT_MSG_UNLESS(lowest > 0 && highest > lowest, "Invalid histogram range");
+    NS_ABORT_MSG_UNLESS(subBuckets > 0, "At least one sub-bucket is needed");
+
+    int maxExponent;
+    std::frexp(lowest, &m_minExponent);
+    std::frexp(highest, &maxExponent);
+    m_maxBuckets = static_cast<uint32_t>(maxExponent - m_minExponent + 1) * m_subBuckets;
+    Reset();
+}
+
+void
+LogLinearHistogram::Update(double value)
+{
+    NS_LOG_FUNCTION(this << value);
+
+    uint32_t index = GetBucketIndex(value);
+    Reserve(index);
+    ++m_count[index - m_offset];
+
+    if (m_n == 0)
+    {
+        m_min = value;
+        m_max = value;
+    }
+    else
+    {
+        m_min = std::min(m_min, value);
+        m_max = std::max(m_max, value);
+    }
+    ++m_n;
+    double delta = value - m_mean;
+    m_mean += delta / m_n;
+    m_m2 += delta * (value - m_mean);
+}
+
+void
+LogLinearHistogram::Merge(const LogLinearHistogram& other)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_UNLESS(m_minExponent == other.m_minExponent &&
+                            m_subBuckets == other.m_subBuckets &&
+                            m_maxBuckets == other.m_maxBuckets,
+                        "Cannot merge histograms with a different layout");
+
+    if (other.m_n == 0)
+    {
+        return;
+    }
+
+    Reserve(other.m_offset);
+    Reserve(other.m_offset + other.m_count.size() - 1);
+    for (std::size_t i = 0; i < other.m_count.size(); ++i)
+    {
+        m_count[other.m_offset + i - m_offset] += other.m_count[i];
+    }
+
+    if (m_n == 0)
+    {
+        m_min = other.m_min;
+        m_max = other.m_max;
+    }
+    else
+    {
+        m_min = std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+    }
+    // Chan et al. pairwise combination of the running moments
+    double n = static_cast<double>(m_n + other.m_n);
+    double delta = other.m_mean - m_mean;
+    m_mean += delta * other.m_n / n;
+    m_m2 += other.m_m2 + delta * delta * m_n * other.m_n / n;
+    m_n += other.m_n;
+}
+
+void
+LogLinearHistogram::Reset()
+{
+    NS_LOG_FUNCTION(this);
+    m_count.clear();
+    m_offset = 0;
+    m_n = 0;
+    m_min = 0;
+    m_max = 0;
+    m_mean = 0;
+    m_m2 = 0;
+}
+
+uint64_t
+LogLinearHistogram::GetCount() const
+{
+    return m_n;
+}
+
+double
+LogLinearHistogram::GetMin() const
+{
+    return m_min;
+}
+
+double
+LogLinearHistogram::GetMax() const
+{
+    return m_max;
+}
+
+double
+LogLinearHistogram::GetMean() const
+{
+    return m_mean;
+}
+
+double
+LogLinearHistogram::GetVariance() const
+{
+    return (m_n > 1) ? m_m2 / (m_n - 1) : 0.0;
+}
+
+double
+LogLinearHistogram::GetStddev() const
+{
+    return std::sqrt(GetVariance());
+}
+
+double
+LogLinearHistogram::GetQuantile(double q) const
+{
+    NS_LOG_FUNCTION(this << q);
+    NS_ASSERT_MSG(q >= 0 && q <= 1, "Quantile out of range: " << q);
+
+    if (m_n == 0)
+    {
+        return 0.0;
+    }
+    if (q <= 0)
+    {
+        return m_min;
+    }
+    if (q >= 1)
+    {
+        return m_max;
+    }
+
+    auto rank = static_cast<uint64_t>(std::ceil(q * m_n));
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < m_count.size(); ++i)
+    {
+        seen += m_count[i];
+        if (seen >= rank)
+        {
+            uint32_t index = m_offset + i;
+            double mid = (GetBucketStart(index) + GetBucketStart(index + 1)) / 2;
+            return std::clamp(mid, m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+double
+LogLinearHistogram::GetRelativeError() const
+{
+    return 1.0 / (2.0 * m_subBuckets);
+}
+
+uint32_t
+LogLinearHistogram::GetNBuckets() const
+{
+    return m_count.size();
+}
+
+uint32_t
+LogLinearHistogram::GetBucketIndex(double value) const
+{
+    if (!(value > 0))
+    {
+        return 0;
+    }
+
+    int exponent;
+    double mantissa = std::frexp(value, &exponent);
+    if (exponent < m_minExponent)
+    {
+        return 0;
+    }
+    // mantissa is in [0.5, 1): map it linearly onto the sub-buckets
+    auto sub = static_cast<uint64_t>((2 * mantissa - 1) * m_subBuckets);
+    uint64_t index = static_cast<uint64_t>(exponent - m_minExponent) * m_subBuckets + sub;
+    return static_cast<uint32_t>(std::min<uint64_t>(index, m_maxBuckets - 1));
+}
+
+double
+LogLinearHistogram::GetBucketStart(uint32_t index) const
+{
+    int exponent = m_minExponent + static_cast<int>(index / m_subBuckets);
+    double sub = static_cast<double>(index % m_subBuckets) / m_subBuckets;
+    return std::ldexp(1 + sub, exponent - 1);
+}
+
+void
+LogLinearHistogram::Reserve(uint32_t index)
+{
+    if (m_count.empty())
+    {
+        m_offset = index;
+        m_count.resize(1, 0);
+    }
+    else if (index < m_offset)
+    {
+        m_count.insert(m_count.begin(), m_offset - index, 0);
+        m_offset = index;
+    }
+    else if (index >= m_offset + m_count.size())
+    {
+        m_count.resize(index - m_offset + 1, 0);
+    }
+}
+
+} // namespace ns3
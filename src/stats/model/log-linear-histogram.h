@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LOG_LINEAR_HISTOGRAM_H
+#define LOG_LINEAR_HISTOGRAM_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * @brief Streaming summary of a positive-valued sample in bounded memory.
+ *
+ * Every power-of-two interval [2^e, 2^(e+1)) inside the configured range
+ * is split into a fixed number of linear sub-buckets, so the width of a
+ * bucket is proportional to the values it holds and every quantile is
+ * reported within a constant relative error of 1 / (2 * subBuckets).
+ * Only the span of buckets actually touched by the sample is allocated,
+ * and that span can never exceed the configured range, so memory does not
+ * grow with the number of samples.
+ *
+ * Count, minimum, maximum, mean and variance are tracked exactly (the latter
+ * two with Welford's algorithm). Two histograms with the same layout can be
+ * merged, e.g. to combine the results of independent replications.
+ *
+ * Update() has the signature of a plain double-valued trace sink, so an
+ * instance can be connected directly to any trace source, e.g.
+ * @code
+ *   LogLinearHistogram h;
+ *   obj->TraceConnectWithoutContext("Latency", MakeCallback(&LogLinearHistogram::Update, &h));
+ * @endcode
+ *
+ * Values smaller than the lowest trackable value are accounted in the first
+ * bucket and values larger than the highest one in the last bucket; the
+ * reported quantiles are always clamped to the observed [min, max].
+ */
+class LogLinearHistogram
+{
+  public:
+    /**
+     * Create a histogram covering [1e-6, 1e6] with 64 sub-buckets per
+     * power of two (relative error below 0.8%).
+     */
+    LogLinearHistogram();
+
+    /**
+     * @brief Constructor
+     * @param lowest the smallest value resolved by the histogram (must be > 0)
+     * @param highest the largest value resolved by the histogram
+     * @param subBuckets the number of linear buckets per power of two
+     */
+    LogLinearHistogram(double lowest, double highest, uint32_t subBuckets);
+
+    /**
+     * @brief Add a sample
+     * @param value the sample to add
+     */
+    void Update(double value);
+
+    /**
+     * @brief Add all the samples recorded by another histogram.
+     *
+     * Both histograms must have been built with the same range and number
+     * of sub-buckets.
+     *
+     * @param other the histogram to merge into this one
+     */
+    void Merge(const LogLinearHistogram& other);
+
+    /**
+     * Clear the histogram content, keeping its layout.
+     */
+    void Reset();
+
+    /**
+     * @return the number of samples
+     */
+    uint64_t GetCount() const;
+    /**
+     * @return the smallest sample, or 0 if the histogram is empty
+     */
+    double GetMin() const;
+    /**
+     * @return the largest sample, or 0 if the histogram is empty
+     */
+    double GetMax() const;
+    /**
+     * @return the sample mean, or 0 if the histogram is empty
+     */
+    double GetMean() const;
+    /**
+     * @return the unbiased sample variance, or 0 with less than two samples
+     */
+    double GetVariance() const;
+    /**
+     * @return the sample standard deviation
+     */
+    double GetStddev() const;
+
+    /**
+     * @brief Estimate a quantile of the sample.
+     * @param q the quantile, in [0, 1] (e.g., 0.95 for the 95th percentile)
+     * @return the estimated quantile, or 0 if the histogram is empty
+     */
+    double GetQuantile(double q) const;
+
+    /**
+     * @return the maximum relative error of the quantiles within the range
+     */
+    double GetRelativeError() const;
+
+    /**
+     * @return the number of buckets currently allocated
+     */
+    uint32_t GetNBuckets() const;
+
+  private:
+    /**
+     * @param value a sample
+     * @return the global index of the bucket holding the sample
+     */
+    uint32_t GetBucketIndex(double value) const;
+    /**
+     * @param index a global bucket index
+     * @return the lower bound of the bucket
+     */
+    double GetBucketStart(uint32_t index) const;
+    /**
+     * Make sure the allocated span of buckets covers a global index.
+     * @param index a global bucket index
+     */
+    void Reserve(uint32_t index);
+
+    int m_minExponent;             //!< Binary exponent of the first bucket
+    uint32_t m_subBuckets;         //!< Number of buckets per power of two
+    uint32_t m_maxBuckets;         //!< Number of buckets of the whole range
+    std::vector<uint64_t> m_count; //!< Counts of the allocated buckets
+    uint32_t m_offset;             //!< Global index of m_count[0]
+
+    uint64_t m_n;  //!< Number of samples
+    double m_min;  //!< Smallest sample
+    double m_max;  //!< Largest sample
+    double m_mean; //!< Running mean
+    double m_m2;   //!< Running sum of squared differences from the mean
+};
+
+} // namespace ns3
+
+#endif /* LOG_LINEAR_HISTOGRAM_H */
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026
+ *
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/log-linear-histogram.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief LogLinearHistogram quantile and moment test
+ */
+class LogLinearHistogramTestCase : public TestCase
+{
+  public:
+    LogLinearHistogramTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LogLinearHistogramTestCase::LogLinearHistogramTestCase()
+    : TestCase("LogLinearHistogram quantiles and moments")
+{
+}
+
+void
+LogLinearHistogramTestCase::DoRun()
+{
+    LogLinearHistogram h;
+    NS_TEST_EXPECT_MSG_EQ(h.GetCount(), 0, "Histogram should start empty");
+    NS_TEST_EXPECT_MSG_EQ(h.GetQuantile(0.5), 0.0, "Empty histogram has no quantiles");
+
+    // 1, 2, ..., 1000: exact quantiles are known
+    std::vector<double> values;
+    for (int i = 1; i <= 1000; i++)
+    {
+        values.push_back(i);
+    }
+    std::reverse(values.begin(), values.end());
+    for (double v : values)
+    {
+        h.Update(v);
+    }
+
+    double tol = h.GetRelativeError();
+    NS_TEST_EXPECT_MSG_EQ(h.GetCount(), 1000, "Wrong sample count");
+    NS_TEST_EXPECT_MSG_EQ(h.GetMin(), 1.0, "Wrong minimum");
+    NS_TEST_EXPECT_MSG_EQ(h.GetMax(), 1000.0, "Wrong maximum");
+    NS_TEST_EXPECT_MSG_EQ_TOL(h.GetMean(), 500.5, 1e-9, "Wrong mean");
+    NS_TEST_EXPECT_MSG_EQ_TOL(h.GetVariance(), 1000.0 * 1001 / 12, 1e-6, "Wrong variance");
+    NS_TEST_EXPECT_MSG_EQ_TOL(h.GetQuantile(0.5), 500, 500 * tol, "Wrong median");
+    NS_TEST_EXPECT_MSG_EQ_TOL(h.GetQuantile(0.95), 950, 950 * tol, "Wrong 95th percentile");
+    NS_TEST_EXPECT_MSG_EQ_TOL(h.GetQuantile(0.99), 990, 990 * tol, "Wrong 99th percentile");
+    NS_TEST_EXPECT_MSG_EQ(h.GetQuantile(1), 1000.0, "Wrong 100th percentile");
+
+    // 1..1000 spans 10 octaves: only those buckets may be allocated
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(h.GetNBuckets(), 10 * 64, "Too many buckets allocated");
+
+    // Memory does not depend on the number of samples
+    uint32_t buckets = h.GetNBuckets();
+    for (int i = 0; i < 100000; i++)
+    {
+        h.Update(1 + (i % 1000));
+    }
+    NS_TEST_EXPECT_MSG_EQ(h.GetNBuckets(), buckets, "Buckets grew with the sample size");
+
+    // Out of range values are clamped, but min and max remain exact
+    LogLinearHistogram small(1, 100, 8);
+    small.Update(1e-3);
+    small.Update(1e6);
+    NS_TEST_EXPECT_MSG_EQ(small.GetMin(), 1e-3, "Wrong minimum");
+    NS_TEST_EXPECT_MSG_EQ(small.GetMax(), 1e6, "Wrong maximum");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(small.GetNBuckets(), 8 * 8, "Range not bounded");
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief LogLinearHistogram merge test
+ */
+class LogLinearHistogramMergeTestCase : public TestCase
+{
+  public:
+    LogLinearHistogramMergeTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LogLinearHistogramMergeTestCase::LogLinearHistogramMergeTestCase()
+    : TestCase("LogLinearHistogram merge")
+{
+}
+
+void
+LogLinearHistogramMergeTestCase::DoRun()
+{
+    LogLinearHistogram all;
+    LogLinearHistogram low;
+    LogLinearHistogram high;
+    for (int i = 1; i <= 500; i++)
+    {
+        double v = 0.01 * i;
+        all.Update(v);
+        low.Update(v);
+    }
+    for (int i = 501; i <= 1000; i++)
+    {
+        double v = 0.01 * i;
+        all.Update(v);
+        high.Update(v);
+    }
+
+    // Merge the higher half into the lower one and vice versa
+    LogLinearHistogram lowFirst = low;
+    lowFirst.Merge(high);
+    high.Merge(low);
+
+    for (const auto& merged : {lowFirst, high})
+    {
+        NS_TEST_EXPECT_MSG_EQ(merged.GetCount(), all.GetCount(), "Wrong merged count");
+        NS_TEST_EXPECT_MSG_EQ(merged.GetMin(), all.GetMin(), "Wrong merged minimum");
+        NS_TEST_EXPECT_MSG_EQ(merged.GetMax(), all.GetMax(), "Wrong merged maximum");
+        NS_TEST_EXPECT_MSG_EQ_TOL(merged.GetMean(), all.GetMean(), 1e-9, "Wrong merged mean");
+        NS_TEST_EXPECT_MSG_EQ_TOL(merged.GetVariance(),
+                                  all.GetVariance(),
+                                  1e-9,
+                                  "Wrong merged variance");
+        NS_TEST_EXPECT_MSG_EQ(merged.GetNBuckets(), all.GetNBuckets(), "Wrong merged layout");
+        for (double q : {0.1, 0.5, 0.95, 0.99})
+        {
+            NS_TEST_EXPECT_MSG_EQ(merged.GetQuantile(q),
+                                  all.GetQuantile(q),
+                                  "Wrong merged quantile " << q);
+        }
+    }
+
+    // Merging an empty histogram is a no-op
+    LogLinearHistogram empty;
+    lowFirst.Merge(empty);
+    NS_TEST_EXPECT_MSG_EQ(lowFirst.GetCount(), all.GetCount(), "Empty merge changed the count");
+    empty.Merge(lowFirst);
+    NS_TEST_EXPECT_MSG_EQ_TOL(empty.GetMean(), all.GetMean(), 1e-9, "Wrong mean after merge");
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief LogLinearHistogram TestSuite
+ */
+class LogLinearHistogramTestSuite : public TestSuite
+{
+  public:
+    LogLinearHistogramTestSuite();
+};
+
+LogLinearHistogramTestSuite::LogLinearHistogramTestSuite()
+    : TestSuite("log-linear-histogram", Type::UNIT)
+{
+    AddTestCase(new LogLinearHistogramTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new LogLinearHistogramMergeTestCase, TestCase::Duration::QUICK);
+}
+
+static LogLinearHistogramTestSuite
+    g_logLinearHistogramTestSuite; //!< Static variable for test initialization
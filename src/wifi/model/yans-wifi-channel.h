@@ -48,6 +48,15 @@ class YansWifiChannel : public Channel
     std::size_t GetNDevices() const override;
     Ptr<NetDevice> GetDevice(std::size_t i) const override;
 
+    /**
+     * The smallest propagation delay between two PHYs of different nodes,
+     * at their current positions. Only a ConstantSpeedPropagationDelayModel
+     * can be bounded: other delay models give no lookahead.
+     *
+     * @returns the minimum delay
+     */
+    Time GetMinimumDelay() const override;
+
     /**
      * Adds the given YansWifiPhy to the PHY list
      *
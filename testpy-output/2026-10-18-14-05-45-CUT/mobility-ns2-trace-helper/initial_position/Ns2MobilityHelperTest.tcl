@@ -0,0 +1,3 @@
+$node_(0) set X_ 1.0
+$node_(0) set Y_ 2.0
+$node_(0) set Z_ 3.0
@@ -36,6 +36,9 @@ std::string g_me;
 /** Output field width for numeric data. */
 int g_fwidth = 6;
 
+/** Compare each scheduler without and with the event pool. */
+bool g_pool = false;
+
 /**
  *  Benchmark instance which can do a single run.
  *
@@ -92,10 +95,12 @@ class Bench
     /** The output. */
     struct Result
     {
-        double init;     /**< Time (s) for initialization. */
-        double simu;     /**< Time (s) for simulation. */
-        uint64_t pop;    /**< Event population. */
-        uint64_t events; /**< Number of events executed. */
+        double init;         /**< Time (s) for initialization. */
+        double simu;         /**< Time (s) for simulation. */
+        uint64_t pop;        /**< Event population. */
+        uint64_t events;     /**< Number of events executed. */
+        uint64_t allocs;     /**< Number of events allocated. */
+        uint64_t heapAllocs; /**< Number of those taken from the global allocator. */
     };
 
     /**
@@ -127,6 +132,7 @@ Bench::Run()
 
     DEB("initializing");
     m_count = 0;
+    EventPool::ResetStats();
 
     timer.Start();
     for (uint64_t i = 0; i < m_population; ++i)
@@ -145,7 +151,8 @@ Bench::Run()
 
     Simulator::Destroy();
 
-    return Result{init, simu, m_population, m_count};
+    EventPool::Stats stats = EventPool::GetStats();
+    return Result{init, simu, m_population, m_count, stats.allocations, stats.heapAllocations};
 }
 
 void
@@ -229,6 +236,8 @@ class BenchSuite
 
     std::string m_scheduler;       /**< Descriptive string for the scheduler. */
     std::vector<Result> m_results; /**< Store for the run results. */
+    uint64_t m_allocs;             /**< Events allocated by the last run. */
+    uint64_t m_heapAllocs;         /**< Events of the last run taken from the heap. */
 
 }; // BenchSuite
 
@@ -270,6 +279,13 @@ BenchSuite::BenchSuite(ObjectFactory& factory,
     {
         m_scheduler += " (default)";
     }
+    if (g_pool)
+    {
+        m_scheduler += ", event pool " + std::string(EventPool::IsEnabled() ? "on" : "off");
+    }
+
+    m_allocs = 0;
+    m_heapAllocs = 0;
 
     Bench bench(pop, total);
     bench.SetRandomStream(eventStream);
@@ -290,6 +306,8 @@ BenchSuite::BenchSuite(ObjectFactory& factory,
         auto run = bench.Run();
         m_results.push_back(Result::Bench(run));
         m_results.back().Log(i);
+        m_allocs = run.allocs;
+        m_heapAllocs = run.heapAllocs;
     }
 
     Simulator::Destroy();
@@ -318,6 +336,11 @@ BenchSuite::Header() const
 void
 BenchSuite::Log() const
 {
+    if (g_pool)
+    {
+        LOG("Events allocated per run: " << m_allocs << ", from the heap: " << m_heapAllocs);
+    }
+
     if (m_results.size() < 2)
     {
         LOG("");
@@ -446,6 +469,7 @@ main(int argc, char* argv[])
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
+    bool schedQuad = false;
 
     uint64_t pop = 100000;
     uint64_t total = 1000000;
@@ -463,6 +487,11 @@ main(int argc, char* argv[])
               "In the case of either --file form, the input is expected\n"
               "to be ascii, giving the relative event times in ns.\n"
               "\n"
+              "The event times of a real simulation can be recorded with\n"
+              "a build that has logging enabled:\n"
+              "  NS_LOG=DefaultSimulatorImpl=level_function ./ns3 run <program> 2>&1 |\n"
+              "    sed -n 's/.*:Schedule(0x[0-9a-f]*, \\([0-9]*\\),.*/\\1e-9/p' > events.txt\n"
+              "\n"
               "If no scheduler is specified the MapScheduler will be run.");
     cmd.AddValue("all", "use all schedulers", allSched);
     cmd.AddValue("cal", "use CalendarScheduler", schedCal);
@@ -471,12 +500,14 @@ main(int argc, char* argv[])
     cmd.AddValue("list", "use ListScheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
+    cmd.AddValue("quad", "use QuadHeapScheduler", schedQuad);
     cmd.AddValue("debug", "enable debugging output", g_debug);
     cmd.AddValue("pop", "event population size", pop);
     cmd.AddValue("total", "total number of events to run", total);
     cmd.AddValue("runs", "number of runs", runs);
     cmd.AddValue("file", "file of relative event times", filename);
     cmd.AddValue("prec", "printed output precision", g_fwidth);
+    cmd.AddValue("pool", "run each scheduler without, then with the event pool", g_pool);
     cmd.Parse(argc, argv);
 
     g_me = cmd.GetName() + ": ";
@@ -491,32 +522,43 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedHeap = schedList = schedMap = schedPQ = schedQuad = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ || schedQuad))
     {
         schedMap = true;
     }
 
     auto eventStream = GetRandomStream(filename);
 
+    // Run the suite, twice when comparing the event pool
+    auto bench = [&](ObjectFactory& schedFactory, uint64_t schedTotal, bool schedRev) {
+        if (g_pool)
+        {
+            EventPool::SetEnabled(false);
+            BenchSuite(schedFactory, pop, schedTotal, runs, eventStream, schedRev).Log();
+            EventPool::SetEnabled(true);
+        }
+        BenchSuite(schedFactory, pop, schedTotal, runs, eventStream, schedRev).Log();
+    };
+
     ObjectFactory factory("ns3::MapScheduler");
     if (schedCal)
     {
         factory.SetTypeId("ns3::CalendarScheduler");
         factory.Set("Reverse", BooleanValue(calRev));
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        bench(factory, total, calRev);
         if (allSched)
         {
             factory.Set("Reverse", BooleanValue(!calRev));
-            BenchSuite(factory, pop, total, runs, eventStream, !calRev).Log();
+            bench(factory, total, !calRev);
         }
     }
     if (schedHeap)
     {
         factory.SetTypeId("ns3::HeapScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        bench(factory, total, calRev);
     }
     if (schedList)
     {
@@ -527,17 +569,22 @@ main(int argc, char* argv[])
             LOG("Running List scheduler with 1/10 total events");
             listTotal /= 10;
         }
-        BenchSuite(factory, pop, listTotal, runs, eventStream, calRev).Log();
+        bench(factory, listTotal, calRev);
     }
     if (schedMap)
     {
         factory.SetTypeId("ns3::MapScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        bench(factory, total, calRev);
     }
     if (schedPQ)
     {
         factory.SetTypeId("ns3::PriorityQueueScheduler");
-        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+        bench(factory, total, calRev);
+    }
+    if (schedQuad)
+    {
+        factory.SetTypeId("ns3::QuadHeapScheduler");
+        bench(factory, total, calRev);
     }
 
     return 0;